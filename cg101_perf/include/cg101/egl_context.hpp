@@ -0,0 +1,114 @@
+// include/cg101/egl_context.hpp
+#pragma once
+#include <cstdio>
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace cg101 {
+
+// window 없이 OpenGL 3.3+ core context를 만든다.
+// CH1의 glfwCreateWindow 대신 EGL을 사용하므로 GPU가 없는 CI(llvmpipe)에서도 동작한다.
+// default framebuffer는 1x1 pbuffer이므로(없으면 surfaceless) 실제 렌더 결과는 FBO에 기록한다.
+struct HeadlessContext {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface surface = EGL_NO_SURFACE;
+};
+
+static inline EGLDisplay getHeadlessDisplay() {
+    // Mesa surfaceless platform이 있으면 X/Wayland 없이 display를 얻는다
+    auto getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    EGLDisplay dpy = EGL_NO_DISPLAY;
+    if (getPlatformDisplay)
+        dpy = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    if (dpy == EGL_NO_DISPLAY)
+        dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    return dpy;
+}
+
+// 성공 시 context를 현재 thread에 make current하고 GLAD까지 로딩한다.
+static inline bool createHeadlessContext(HeadlessContext& out) {
+    EGLDisplay dpy = getHeadlessDisplay();
+    EGLint major = 0, minor = 0;
+    if (dpy == EGL_NO_DISPLAY || !eglInitialize(dpy, &major, &minor)) {
+        std::fprintf(stderr, "eglInitialize failed! (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    const EGLint cfgAttribs[] = {
+        EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig cfg = nullptr;
+    EGLint numCfg = 0;
+    eglChooseConfig(dpy, cfgAttribs, &cfg, 1, &numCfg);
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::fprintf(stderr, "eglBindAPI(EGL_OPENGL_API) failed!\n");
+        eglTerminate(dpy);
+        return false;
+    }
+
+    // CH1과 동일하게 3.3 core profile 요청
+    const EGLint ctxAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION,       3,
+        EGL_CONTEXT_MINOR_VERSION,       3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext ctx = eglCreateContext(dpy, numCfg > 0 ? cfg : EGL_NO_CONFIG_KHR,
+                                      EGL_NO_CONTEXT, ctxAttribs);
+    if (ctx == EGL_NO_CONTEXT) {
+        std::fprintf(stderr, "eglCreateContext failed! (0x%x)\n", eglGetError());
+        eglTerminate(dpy);
+        return false;
+    }
+
+    // surfaceless에서는 default framebuffer가 incomplete라서, FBO를 바인딩하지 않은 draw
+    // (예: GL_RASTERIZER_DISCARD + transform feedback)가 GL_INVALID_FRAMEBUFFER_OPERATION이 된다.
+    // 1x1 pbuffer를 붙여 default framebuffer를 complete 상태로 유지한다.
+    EGLSurface surf = EGL_NO_SURFACE;
+    if (numCfg > 0) {
+        const EGLint pbAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surf = eglCreatePbufferSurface(dpy, cfg, pbAttribs);
+    }
+
+    if (!eglMakeCurrent(dpy, surf, surf, ctx)) {
+        std::fprintf(stderr, "eglMakeCurrent failed! (0x%x)\n", eglGetError());
+        if (surf != EGL_NO_SURFACE) eglDestroySurface(dpy, surf);
+        eglDestroyContext(dpy, ctx);
+        eglTerminate(dpy);
+        return false;
+    }
+
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress)) {
+        std::fprintf(stderr, "gladLoadGLLoader failed!\n");
+        eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surf != EGL_NO_SURFACE) eglDestroySurface(dpy, surf);
+        eglDestroyContext(dpy, ctx);
+        eglTerminate(dpy);
+        return false;
+    }
+
+    out.display = dpy;
+    out.context = ctx;
+    out.surface = surf;
+    return true;
+}
+
+static inline void destroyHeadlessContext(HeadlessContext& hc) {
+    if (hc.display == EGL_NO_DISPLAY) return;
+
+    eglMakeCurrent(hc.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (hc.surface != EGL_NO_SURFACE) eglDestroySurface(hc.display, hc.surface);
+    if (hc.context != EGL_NO_CONTEXT) eglDestroyContext(hc.display, hc.context);
+    eglTerminate(hc.display);
+    hc = {};
+}
+
+} // namespace cg101
@@ -0,0 +1,236 @@
+// include/cg101/gl_func_list.hpp
+#pragma once
+
+// external/glad/include/glad/glad.h가 선언한 glad_glXxx 함수 포인터 전체 (GL 4.6 core, 선언 순서 그대로).
+// glad를 다시 생성하면 이 목록도 같은 방식으로 다시 뽑는다:
+//   grep -o '^GLAPI PFN[A-Z0-9_]*PROC glad_gl[A-Za-z0-9_]*' glad.h
+// gl_trace.hpp가 capture 중에 모든 GL 진입점을 thunk로 바꿔 끼우는 데 사용한다.
+
+#define CG101_GL_ALL_FUNCS(X) \
+    X(CullFace) X(FrontFace) X(Hint) X(LineWidth) X(PointSize) X(PolygonMode) X(Scissor)              \
+    X(TexParameterf) X(TexParameterfv) X(TexParameteri) X(TexParameteriv) X(TexImage1D)               \
+    X(TexImage2D) X(DrawBuffer) X(Clear) X(ClearColor) X(ClearStencil) X(ClearDepth) X(StencilMask)   \
+    X(ColorMask) X(DepthMask) X(Disable) X(Enable) X(Finish) X(Flush) X(BlendFunc) X(LogicOp)         \
+    X(StencilFunc) X(StencilOp) X(DepthFunc) X(PixelStoref) X(PixelStorei) X(ReadBuffer)              \
+    X(ReadPixels) X(GetBooleanv) X(GetDoublev) X(GetError) X(GetFloatv) X(GetIntegerv) X(GetString)   \
+    X(GetTexImage) X(GetTexParameterfv) X(GetTexParameteriv) X(GetTexLevelParameterfv)                \
+    X(GetTexLevelParameteriv) X(IsEnabled) X(DepthRange) X(Viewport) X(NewList) X(EndList)            \
+    X(CallList) X(CallLists) X(DeleteLists) X(GenLists) X(ListBase) X(Begin) X(Bitmap) X(Color3b)     \
+    X(Color3bv) X(Color3d) X(Color3dv) X(Color3f) X(Color3fv) X(Color3i) X(Color3iv) X(Color3s)       \
+    X(Color3sv) X(Color3ub) X(Color3ubv) X(Color3ui) X(Color3uiv) X(Color3us) X(Color3usv)            \
+    X(Color4b) X(Color4bv) X(Color4d) X(Color4dv) X(Color4f) X(Color4fv) X(Color4i) X(Color4iv)       \
+    X(Color4s) X(Color4sv) X(Color4ub) X(Color4ubv) X(Color4ui) X(Color4uiv) X(Color4us)              \
+    X(Color4usv) X(EdgeFlag) X(EdgeFlagv) X(End) X(Indexd) X(Indexdv) X(Indexf) X(Indexfv) X(Indexi)  \
+    X(Indexiv) X(Indexs) X(Indexsv) X(Normal3b) X(Normal3bv) X(Normal3d) X(Normal3dv) X(Normal3f)     \
+    X(Normal3fv) X(Normal3i) X(Normal3iv) X(Normal3s) X(Normal3sv) X(RasterPos2d) X(RasterPos2dv)     \
+    X(RasterPos2f) X(RasterPos2fv) X(RasterPos2i) X(RasterPos2iv) X(RasterPos2s) X(RasterPos2sv)      \
+    X(RasterPos3d) X(RasterPos3dv) X(RasterPos3f) X(RasterPos3fv) X(RasterPos3i) X(RasterPos3iv)      \
+    X(RasterPos3s) X(RasterPos3sv) X(RasterPos4d) X(RasterPos4dv) X(RasterPos4f) X(RasterPos4fv)      \
+    X(RasterPos4i) X(RasterPos4iv) X(RasterPos4s) X(RasterPos4sv) X(Rectd) X(Rectdv) X(Rectf)         \
+    X(Rectfv) X(Recti) X(Rectiv) X(Rects) X(Rectsv) X(TexCoord1d) X(TexCoord1dv) X(TexCoord1f)        \
+    X(TexCoord1fv) X(TexCoord1i) X(TexCoord1iv) X(TexCoord1s) X(TexCoord1sv) X(TexCoord2d)            \
+    X(TexCoord2dv) X(TexCoord2f) X(TexCoord2fv) X(TexCoord2i) X(TexCoord2iv) X(TexCoord2s)            \
+    X(TexCoord2sv) X(TexCoord3d) X(TexCoord3dv) X(TexCoord3f) X(TexCoord3fv) X(TexCoord3i)            \
+    X(TexCoord3iv) X(TexCoord3s) X(TexCoord3sv) X(TexCoord4d) X(TexCoord4dv) X(TexCoord4f)            \
+    X(TexCoord4fv) X(TexCoord4i) X(TexCoord4iv) X(TexCoord4s) X(TexCoord4sv) X(Vertex2d)              \
+    X(Vertex2dv) X(Vertex2f) X(Vertex2fv) X(Vertex2i) X(Vertex2iv) X(Vertex2s) X(Vertex2sv)           \
+    X(Vertex3d) X(Vertex3dv) X(Vertex3f) X(Vertex3fv) X(Vertex3i) X(Vertex3iv) X(Vertex3s)            \
+    X(Vertex3sv) X(Vertex4d) X(Vertex4dv) X(Vertex4f) X(Vertex4fv) X(Vertex4i) X(Vertex4iv)           \
+    X(Vertex4s) X(Vertex4sv) X(ClipPlane) X(ColorMaterial) X(Fogf) X(Fogfv) X(Fogi) X(Fogiv)          \
+    X(Lightf) X(Lightfv) X(Lighti) X(Lightiv) X(LightModelf) X(LightModelfv) X(LightModeli)           \
+    X(LightModeliv) X(LineStipple) X(Materialf) X(Materialfv) X(Materiali) X(Materialiv)              \
+    X(PolygonStipple) X(ShadeModel) X(TexEnvf) X(TexEnvfv) X(TexEnvi) X(TexEnviv) X(TexGend)          \
+    X(TexGendv) X(TexGenf) X(TexGenfv) X(TexGeni) X(TexGeniv) X(FeedbackBuffer) X(SelectBuffer)       \
+    X(RenderMode) X(InitNames) X(LoadName) X(PassThrough) X(PopName) X(PushName) X(ClearAccum)        \
+    X(ClearIndex) X(IndexMask) X(Accum) X(PopAttrib) X(PushAttrib) X(Map1d) X(Map1f) X(Map2d)         \
+    X(Map2f) X(MapGrid1d) X(MapGrid1f) X(MapGrid2d) X(MapGrid2f) X(EvalCoord1d) X(EvalCoord1dv)       \
+    X(EvalCoord1f) X(EvalCoord1fv) X(EvalCoord2d) X(EvalCoord2dv) X(EvalCoord2f) X(EvalCoord2fv)      \
+    X(EvalMesh1) X(EvalPoint1) X(EvalMesh2) X(EvalPoint2) X(AlphaFunc) X(PixelZoom)                   \
+    X(PixelTransferf) X(PixelTransferi) X(PixelMapfv) X(PixelMapuiv) X(PixelMapusv) X(CopyPixels)     \
+    X(DrawPixels) X(GetClipPlane) X(GetLightfv) X(GetLightiv) X(GetMapdv) X(GetMapfv) X(GetMapiv)     \
+    X(GetMaterialfv) X(GetMaterialiv) X(GetPixelMapfv) X(GetPixelMapuiv) X(GetPixelMapusv)            \
+    X(GetPolygonStipple) X(GetTexEnvfv) X(GetTexEnviv) X(GetTexGendv) X(GetTexGenfv) X(GetTexGeniv)   \
+    X(IsList) X(Frustum) X(LoadIdentity) X(LoadMatrixf) X(LoadMatrixd) X(MatrixMode) X(MultMatrixf)   \
+    X(MultMatrixd) X(Ortho) X(PopMatrix) X(PushMatrix) X(Rotated) X(Rotatef) X(Scaled) X(Scalef)      \
+    X(Translated) X(Translatef) X(DrawArrays) X(DrawElements) X(GetPointerv) X(PolygonOffset)         \
+    X(CopyTexImage1D) X(CopyTexImage2D) X(CopyTexSubImage1D) X(CopyTexSubImage2D) X(TexSubImage1D)    \
+    X(TexSubImage2D) X(BindTexture) X(DeleteTextures) X(GenTextures) X(IsTexture) X(ArrayElement)     \
+    X(ColorPointer) X(DisableClientState) X(EdgeFlagPointer) X(EnableClientState) X(IndexPointer)     \
+    X(InterleavedArrays) X(NormalPointer) X(TexCoordPointer) X(VertexPointer) X(AreTexturesResident)  \
+    X(PrioritizeTextures) X(Indexub) X(Indexubv) X(PopClientAttrib) X(PushClientAttrib)               \
+    X(DrawRangeElements) X(TexImage3D) X(TexSubImage3D) X(CopyTexSubImage3D) X(ActiveTexture)         \
+    X(SampleCoverage) X(CompressedTexImage3D) X(CompressedTexImage2D) X(CompressedTexImage1D)         \
+    X(CompressedTexSubImage3D) X(CompressedTexSubImage2D) X(CompressedTexSubImage1D)                  \
+    X(GetCompressedTexImage) X(ClientActiveTexture) X(MultiTexCoord1d) X(MultiTexCoord1dv)            \
+    X(MultiTexCoord1f) X(MultiTexCoord1fv) X(MultiTexCoord1i) X(MultiTexCoord1iv) X(MultiTexCoord1s)  \
+    X(MultiTexCoord1sv) X(MultiTexCoord2d) X(MultiTexCoord2dv) X(MultiTexCoord2f)                     \
+    X(MultiTexCoord2fv) X(MultiTexCoord2i) X(MultiTexCoord2iv) X(MultiTexCoord2s)                     \
+    X(MultiTexCoord2sv) X(MultiTexCoord3d) X(MultiTexCoord3dv) X(MultiTexCoord3f)                     \
+    X(MultiTexCoord3fv) X(MultiTexCoord3i) X(MultiTexCoord3iv) X(MultiTexCoord3s)                     \
+    X(MultiTexCoord3sv) X(MultiTexCoord4d) X(MultiTexCoord4dv) X(MultiTexCoord4f)                     \
+    X(MultiTexCoord4fv) X(MultiTexCoord4i) X(MultiTexCoord4iv) X(MultiTexCoord4s)                     \
+    X(MultiTexCoord4sv) X(LoadTransposeMatrixf) X(LoadTransposeMatrixd) X(MultTransposeMatrixf)       \
+    X(MultTransposeMatrixd) X(BlendFuncSeparate) X(MultiDrawArrays) X(MultiDrawElements)              \
+    X(PointParameterf) X(PointParameterfv) X(PointParameteri) X(PointParameteriv) X(FogCoordf)        \
+    X(FogCoordfv) X(FogCoordd) X(FogCoorddv) X(FogCoordPointer) X(SecondaryColor3b)                   \
+    X(SecondaryColor3bv) X(SecondaryColor3d) X(SecondaryColor3dv) X(SecondaryColor3f)                 \
+    X(SecondaryColor3fv) X(SecondaryColor3i) X(SecondaryColor3iv) X(SecondaryColor3s)                 \
+    X(SecondaryColor3sv) X(SecondaryColor3ub) X(SecondaryColor3ubv) X(SecondaryColor3ui)              \
+    X(SecondaryColor3uiv) X(SecondaryColor3us) X(SecondaryColor3usv) X(SecondaryColorPointer)         \
+    X(WindowPos2d) X(WindowPos2dv) X(WindowPos2f) X(WindowPos2fv) X(WindowPos2i) X(WindowPos2iv)      \
+    X(WindowPos2s) X(WindowPos2sv) X(WindowPos3d) X(WindowPos3dv) X(WindowPos3f) X(WindowPos3fv)      \
+    X(WindowPos3i) X(WindowPos3iv) X(WindowPos3s) X(WindowPos3sv) X(BlendColor) X(BlendEquation)      \
+    X(GenQueries) X(DeleteQueries) X(IsQuery) X(BeginQuery) X(EndQuery) X(GetQueryiv)                 \
+    X(GetQueryObjectiv) X(GetQueryObjectuiv) X(BindBuffer) X(DeleteBuffers) X(GenBuffers)             \
+    X(IsBuffer) X(BufferData) X(BufferSubData) X(GetBufferSubData) X(MapBuffer) X(UnmapBuffer)        \
+    X(GetBufferParameteriv) X(GetBufferPointerv) X(BlendEquationSeparate) X(DrawBuffers)              \
+    X(StencilOpSeparate) X(StencilFuncSeparate) X(StencilMaskSeparate) X(AttachShader)                \
+    X(BindAttribLocation) X(CompileShader) X(CreateProgram) X(CreateShader) X(DeleteProgram)          \
+    X(DeleteShader) X(DetachShader) X(DisableVertexAttribArray) X(EnableVertexAttribArray)            \
+    X(GetActiveAttrib) X(GetActiveUniform) X(GetAttachedShaders) X(GetAttribLocation)                 \
+    X(GetProgramiv) X(GetProgramInfoLog) X(GetShaderiv) X(GetShaderInfoLog) X(GetShaderSource)        \
+    X(GetUniformLocation) X(GetUniformfv) X(GetUniformiv) X(GetVertexAttribdv) X(GetVertexAttribfv)   \
+    X(GetVertexAttribiv) X(GetVertexAttribPointerv) X(IsProgram) X(IsShader) X(LinkProgram)           \
+    X(ShaderSource) X(UseProgram) X(Uniform1f) X(Uniform2f) X(Uniform3f) X(Uniform4f) X(Uniform1i)    \
+    X(Uniform2i) X(Uniform3i) X(Uniform4i) X(Uniform1fv) X(Uniform2fv) X(Uniform3fv) X(Uniform4fv)    \
+    X(Uniform1iv) X(Uniform2iv) X(Uniform3iv) X(Uniform4iv) X(UniformMatrix2fv) X(UniformMatrix3fv)   \
+    X(UniformMatrix4fv) X(ValidateProgram) X(VertexAttrib1d) X(VertexAttrib1dv) X(VertexAttrib1f)     \
+    X(VertexAttrib1fv) X(VertexAttrib1s) X(VertexAttrib1sv) X(VertexAttrib2d) X(VertexAttrib2dv)      \
+    X(VertexAttrib2f) X(VertexAttrib2fv) X(VertexAttrib2s) X(VertexAttrib2sv) X(VertexAttrib3d)       \
+    X(VertexAttrib3dv) X(VertexAttrib3f) X(VertexAttrib3fv) X(VertexAttrib3s) X(VertexAttrib3sv)      \
+    X(VertexAttrib4Nbv) X(VertexAttrib4Niv) X(VertexAttrib4Nsv) X(VertexAttrib4Nub)                   \
+    X(VertexAttrib4Nubv) X(VertexAttrib4Nuiv) X(VertexAttrib4Nusv) X(VertexAttrib4bv)                 \
+    X(VertexAttrib4d) X(VertexAttrib4dv) X(VertexAttrib4f) X(VertexAttrib4fv) X(VertexAttrib4iv)      \
+    X(VertexAttrib4s) X(VertexAttrib4sv) X(VertexAttrib4ubv) X(VertexAttrib4uiv) X(VertexAttrib4usv)  \
+    X(VertexAttribPointer) X(UniformMatrix2x3fv) X(UniformMatrix3x2fv) X(UniformMatrix2x4fv)          \
+    X(UniformMatrix4x2fv) X(UniformMatrix3x4fv) X(UniformMatrix4x3fv) X(ColorMaski) X(GetBooleani_v)  \
+    X(GetIntegeri_v) X(Enablei) X(Disablei) X(IsEnabledi) X(BeginTransformFeedback)                   \
+    X(EndTransformFeedback) X(BindBufferRange) X(BindBufferBase) X(TransformFeedbackVaryings)         \
+    X(GetTransformFeedbackVarying) X(ClampColor) X(BeginConditionalRender) X(EndConditionalRender)    \
+    X(VertexAttribIPointer) X(GetVertexAttribIiv) X(GetVertexAttribIuiv) X(VertexAttribI1i)           \
+    X(VertexAttribI2i) X(VertexAttribI3i) X(VertexAttribI4i) X(VertexAttribI1ui) X(VertexAttribI2ui)  \
+    X(VertexAttribI3ui) X(VertexAttribI4ui) X(VertexAttribI1iv) X(VertexAttribI2iv)                   \
+    X(VertexAttribI3iv) X(VertexAttribI4iv) X(VertexAttribI1uiv) X(VertexAttribI2uiv)                 \
+    X(VertexAttribI3uiv) X(VertexAttribI4uiv) X(VertexAttribI4bv) X(VertexAttribI4sv)                 \
+    X(VertexAttribI4ubv) X(VertexAttribI4usv) X(GetUniformuiv) X(BindFragDataLocation)                \
+    X(GetFragDataLocation) X(Uniform1ui) X(Uniform2ui) X(Uniform3ui) X(Uniform4ui) X(Uniform1uiv)     \
+    X(Uniform2uiv) X(Uniform3uiv) X(Uniform4uiv) X(TexParameterIiv) X(TexParameterIuiv)               \
+    X(GetTexParameterIiv) X(GetTexParameterIuiv) X(ClearBufferiv) X(ClearBufferuiv) X(ClearBufferfv)  \
+    X(ClearBufferfi) X(GetStringi) X(IsRenderbuffer) X(BindRenderbuffer) X(DeleteRenderbuffers)       \
+    X(GenRenderbuffers) X(RenderbufferStorage) X(GetRenderbufferParameteriv) X(IsFramebuffer)         \
+    X(BindFramebuffer) X(DeleteFramebuffers) X(GenFramebuffers) X(CheckFramebufferStatus)             \
+    X(FramebufferTexture1D) X(FramebufferTexture2D) X(FramebufferTexture3D)                           \
+    X(FramebufferRenderbuffer) X(GetFramebufferAttachmentParameteriv) X(GenerateMipmap)               \
+    X(BlitFramebuffer) X(RenderbufferStorageMultisample) X(FramebufferTextureLayer)                   \
+    X(MapBufferRange) X(FlushMappedBufferRange) X(BindVertexArray) X(DeleteVertexArrays)              \
+    X(GenVertexArrays) X(IsVertexArray) X(DrawArraysInstanced) X(DrawElementsInstanced) X(TexBuffer)  \
+    X(PrimitiveRestartIndex) X(CopyBufferSubData) X(GetUniformIndices) X(GetActiveUniformsiv)         \
+    X(GetActiveUniformName) X(GetUniformBlockIndex) X(GetActiveUniformBlockiv)                        \
+    X(GetActiveUniformBlockName) X(UniformBlockBinding) X(DrawElementsBaseVertex)                     \
+    X(DrawRangeElementsBaseVertex) X(DrawElementsInstancedBaseVertex) X(MultiDrawElementsBaseVertex)  \
+    X(ProvokingVertex) X(FenceSync) X(IsSync) X(DeleteSync) X(ClientWaitSync) X(WaitSync)             \
+    X(GetInteger64v) X(GetSynciv) X(GetInteger64i_v) X(GetBufferParameteri64v) X(FramebufferTexture)  \
+    X(TexImage2DMultisample) X(TexImage3DMultisample) X(GetMultisamplefv) X(SampleMaski)              \
+    X(BindFragDataLocationIndexed) X(GetFragDataIndex) X(GenSamplers) X(DeleteSamplers) X(IsSampler)  \
+    X(BindSampler) X(SamplerParameteri) X(SamplerParameteriv) X(SamplerParameterf)                    \
+    X(SamplerParameterfv) X(SamplerParameterIiv) X(SamplerParameterIuiv) X(GetSamplerParameteriv)     \
+    X(GetSamplerParameterIiv) X(GetSamplerParameterfv) X(GetSamplerParameterIuiv) X(QueryCounter)     \
+    X(GetQueryObjecti64v) X(GetQueryObjectui64v) X(VertexAttribDivisor) X(VertexAttribP1ui)           \
+    X(VertexAttribP1uiv) X(VertexAttribP2ui) X(VertexAttribP2uiv) X(VertexAttribP3ui)                 \
+    X(VertexAttribP3uiv) X(VertexAttribP4ui) X(VertexAttribP4uiv) X(VertexP2ui) X(VertexP2uiv)        \
+    X(VertexP3ui) X(VertexP3uiv) X(VertexP4ui) X(VertexP4uiv) X(TexCoordP1ui) X(TexCoordP1uiv)        \
+    X(TexCoordP2ui) X(TexCoordP2uiv) X(TexCoordP3ui) X(TexCoordP3uiv) X(TexCoordP4ui)                 \
+    X(TexCoordP4uiv) X(MultiTexCoordP1ui) X(MultiTexCoordP1uiv) X(MultiTexCoordP2ui)                  \
+    X(MultiTexCoordP2uiv) X(MultiTexCoordP3ui) X(MultiTexCoordP3uiv) X(MultiTexCoordP4ui)             \
+    X(MultiTexCoordP4uiv) X(NormalP3ui) X(NormalP3uiv) X(ColorP3ui) X(ColorP3uiv) X(ColorP4ui)        \
+    X(ColorP4uiv) X(SecondaryColorP3ui) X(SecondaryColorP3uiv) X(MinSampleShading) X(BlendEquationi)  \
+    X(BlendEquationSeparatei) X(BlendFunci) X(BlendFuncSeparatei) X(DrawArraysIndirect)               \
+    X(DrawElementsIndirect) X(Uniform1d) X(Uniform2d) X(Uniform3d) X(Uniform4d) X(Uniform1dv)         \
+    X(Uniform2dv) X(Uniform3dv) X(Uniform4dv) X(UniformMatrix2dv) X(UniformMatrix3dv)                 \
+    X(UniformMatrix4dv) X(UniformMatrix2x3dv) X(UniformMatrix2x4dv) X(UniformMatrix3x2dv)             \
+    X(UniformMatrix3x4dv) X(UniformMatrix4x2dv) X(UniformMatrix4x3dv) X(GetUniformdv)                 \
+    X(GetSubroutineUniformLocation) X(GetSubroutineIndex) X(GetActiveSubroutineUniformiv)             \
+    X(GetActiveSubroutineUniformName) X(GetActiveSubroutineName) X(UniformSubroutinesuiv)             \
+    X(GetUniformSubroutineuiv) X(GetProgramStageiv) X(PatchParameteri) X(PatchParameterfv)            \
+    X(BindTransformFeedback) X(DeleteTransformFeedbacks) X(GenTransformFeedbacks)                     \
+    X(IsTransformFeedback) X(PauseTransformFeedback) X(ResumeTransformFeedback)                       \
+    X(DrawTransformFeedback) X(DrawTransformFeedbackStream) X(BeginQueryIndexed) X(EndQueryIndexed)   \
+    X(GetQueryIndexediv) X(ReleaseShaderCompiler) X(ShaderBinary) X(GetShaderPrecisionFormat)         \
+    X(DepthRangef) X(ClearDepthf) X(GetProgramBinary) X(ProgramBinary) X(ProgramParameteri)           \
+    X(UseProgramStages) X(ActiveShaderProgram) X(CreateShaderProgramv) X(BindProgramPipeline)         \
+    X(DeleteProgramPipelines) X(GenProgramPipelines) X(IsProgramPipeline) X(GetProgramPipelineiv)     \
+    X(ProgramUniform1i) X(ProgramUniform1iv) X(ProgramUniform1f) X(ProgramUniform1fv)                 \
+    X(ProgramUniform1d) X(ProgramUniform1dv) X(ProgramUniform1ui) X(ProgramUniform1uiv)               \
+    X(ProgramUniform2i) X(ProgramUniform2iv) X(ProgramUniform2f) X(ProgramUniform2fv)                 \
+    X(ProgramUniform2d) X(ProgramUniform2dv) X(ProgramUniform2ui) X(ProgramUniform2uiv)               \
+    X(ProgramUniform3i) X(ProgramUniform3iv) X(ProgramUniform3f) X(ProgramUniform3fv)                 \
+    X(ProgramUniform3d) X(ProgramUniform3dv) X(ProgramUniform3ui) X(ProgramUniform3uiv)               \
+    X(ProgramUniform4i) X(ProgramUniform4iv) X(ProgramUniform4f) X(ProgramUniform4fv)                 \
+    X(ProgramUniform4d) X(ProgramUniform4dv) X(ProgramUniform4ui) X(ProgramUniform4uiv)               \
+    X(ProgramUniformMatrix2fv) X(ProgramUniformMatrix3fv) X(ProgramUniformMatrix4fv)                  \
+    X(ProgramUniformMatrix2dv) X(ProgramUniformMatrix3dv) X(ProgramUniformMatrix4dv)                  \
+    X(ProgramUniformMatrix2x3fv) X(ProgramUniformMatrix3x2fv) X(ProgramUniformMatrix2x4fv)            \
+    X(ProgramUniformMatrix4x2fv) X(ProgramUniformMatrix3x4fv) X(ProgramUniformMatrix4x3fv)            \
+    X(ProgramUniformMatrix2x3dv) X(ProgramUniformMatrix3x2dv) X(ProgramUniformMatrix2x4dv)            \
+    X(ProgramUniformMatrix4x2dv) X(ProgramUniformMatrix3x4dv) X(ProgramUniformMatrix4x3dv)            \
+    X(ValidateProgramPipeline) X(GetProgramPipelineInfoLog) X(VertexAttribL1d) X(VertexAttribL2d)     \
+    X(VertexAttribL3d) X(VertexAttribL4d) X(VertexAttribL1dv) X(VertexAttribL2dv)                     \
+    X(VertexAttribL3dv) X(VertexAttribL4dv) X(VertexAttribLPointer) X(GetVertexAttribLdv)             \
+    X(ViewportArrayv) X(ViewportIndexedf) X(ViewportIndexedfv) X(ScissorArrayv) X(ScissorIndexed)     \
+    X(ScissorIndexedv) X(DepthRangeArrayv) X(DepthRangeIndexed) X(GetFloati_v) X(GetDoublei_v)        \
+    X(DrawArraysInstancedBaseInstance) X(DrawElementsInstancedBaseInstance)                           \
+    X(DrawElementsInstancedBaseVertexBaseInstance) X(GetInternalformativ)                             \
+    X(GetActiveAtomicCounterBufferiv) X(BindImageTexture) X(MemoryBarrier) X(TexStorage1D)            \
+    X(TexStorage2D) X(TexStorage3D) X(DrawTransformFeedbackInstanced)                                 \
+    X(DrawTransformFeedbackStreamInstanced) X(ClearBufferData) X(ClearBufferSubData)                  \
+    X(DispatchCompute) X(DispatchComputeIndirect) X(CopyImageSubData) X(FramebufferParameteri)        \
+    X(GetFramebufferParameteriv) X(GetInternalformati64v) X(InvalidateTexSubImage)                    \
+    X(InvalidateTexImage) X(InvalidateBufferSubData) X(InvalidateBufferData)                          \
+    X(InvalidateFramebuffer) X(InvalidateSubFramebuffer) X(MultiDrawArraysIndirect)                   \
+    X(MultiDrawElementsIndirect) X(GetProgramInterfaceiv) X(GetProgramResourceIndex)                  \
+    X(GetProgramResourceName) X(GetProgramResourceiv) X(GetProgramResourceLocation)                   \
+    X(GetProgramResourceLocationIndex) X(ShaderStorageBlockBinding) X(TexBufferRange)                 \
+    X(TexStorage2DMultisample) X(TexStorage3DMultisample) X(TextureView) X(BindVertexBuffer)          \
+    X(VertexAttribFormat) X(VertexAttribIFormat) X(VertexAttribLFormat) X(VertexAttribBinding)        \
+    X(VertexBindingDivisor) X(DebugMessageControl) X(DebugMessageInsert) X(DebugMessageCallback)      \
+    X(GetDebugMessageLog) X(PushDebugGroup) X(PopDebugGroup) X(ObjectLabel) X(GetObjectLabel)         \
+    X(ObjectPtrLabel) X(GetObjectPtrLabel) X(BufferStorage) X(ClearTexImage) X(ClearTexSubImage)      \
+    X(BindBuffersBase) X(BindBuffersRange) X(BindTextures) X(BindSamplers) X(BindImageTextures)       \
+    X(BindVertexBuffers) X(ClipControl) X(CreateTransformFeedbacks) X(TransformFeedbackBufferBase)    \
+    X(TransformFeedbackBufferRange) X(GetTransformFeedbackiv) X(GetTransformFeedbacki_v)              \
+    X(GetTransformFeedbacki64_v) X(CreateBuffers) X(NamedBufferStorage) X(NamedBufferData)            \
+    X(NamedBufferSubData) X(CopyNamedBufferSubData) X(ClearNamedBufferData)                           \
+    X(ClearNamedBufferSubData) X(MapNamedBuffer) X(MapNamedBufferRange) X(UnmapNamedBuffer)           \
+    X(FlushMappedNamedBufferRange) X(GetNamedBufferParameteriv) X(GetNamedBufferParameteri64v)        \
+    X(GetNamedBufferPointerv) X(GetNamedBufferSubData) X(CreateFramebuffers)                          \
+    X(NamedFramebufferRenderbuffer) X(NamedFramebufferParameteri) X(NamedFramebufferTexture)          \
+    X(NamedFramebufferTextureLayer) X(NamedFramebufferDrawBuffer) X(NamedFramebufferDrawBuffers)      \
+    X(NamedFramebufferReadBuffer) X(InvalidateNamedFramebufferData)                                   \
+    X(InvalidateNamedFramebufferSubData) X(ClearNamedFramebufferiv) X(ClearNamedFramebufferuiv)       \
+    X(ClearNamedFramebufferfv) X(ClearNamedFramebufferfi) X(BlitNamedFramebuffer)                     \
+    X(CheckNamedFramebufferStatus) X(GetNamedFramebufferParameteriv)                                  \
+    X(GetNamedFramebufferAttachmentParameteriv) X(CreateRenderbuffers) X(NamedRenderbufferStorage)    \
+    X(NamedRenderbufferStorageMultisample) X(GetNamedRenderbufferParameteriv) X(CreateTextures)       \
+    X(TextureBuffer) X(TextureBufferRange) X(TextureStorage1D) X(TextureStorage2D)                    \
+    X(TextureStorage3D) X(TextureStorage2DMultisample) X(TextureStorage3DMultisample)                 \
+    X(TextureSubImage1D) X(TextureSubImage2D) X(TextureSubImage3D) X(CompressedTextureSubImage1D)     \
+    X(CompressedTextureSubImage2D) X(CompressedTextureSubImage3D) X(CopyTextureSubImage1D)            \
+    X(CopyTextureSubImage2D) X(CopyTextureSubImage3D) X(TextureParameterf) X(TextureParameterfv)      \
+    X(TextureParameteri) X(TextureParameterIiv) X(TextureParameterIuiv) X(TextureParameteriv)         \
+    X(GenerateTextureMipmap) X(BindTextureUnit) X(GetTextureImage) X(GetCompressedTextureImage)       \
+    X(GetTextureLevelParameterfv) X(GetTextureLevelParameteriv) X(GetTextureParameterfv)              \
+    X(GetTextureParameterIiv) X(GetTextureParameterIuiv) X(GetTextureParameteriv)                     \
+    X(CreateVertexArrays) X(DisableVertexArrayAttrib) X(EnableVertexArrayAttrib)                      \
+    X(VertexArrayElementBuffer) X(VertexArrayVertexBuffer) X(VertexArrayVertexBuffers)                \
+    X(VertexArrayAttribBinding) X(VertexArrayAttribFormat) X(VertexArrayAttribIFormat)                \
+    X(VertexArrayAttribLFormat) X(VertexArrayBindingDivisor) X(GetVertexArrayiv)                      \
+    X(GetVertexArrayIndexediv) X(GetVertexArrayIndexed64iv) X(CreateSamplers)                         \
+    X(CreateProgramPipelines) X(CreateQueries) X(GetQueryBufferObjecti64v) X(GetQueryBufferObjectiv)  \
+    X(GetQueryBufferObjectui64v) X(GetQueryBufferObjectuiv) X(MemoryBarrierByRegion)                  \
+    X(GetTextureSubImage) X(GetCompressedTextureSubImage) X(GetGraphicsResetStatus)                   \
+    X(GetnCompressedTexImage) X(GetnTexImage) X(GetnUniformdv) X(GetnUniformfv) X(GetnUniformiv)      \
+    X(GetnUniformuiv) X(ReadnPixels) X(GetnMapdv) X(GetnMapfv) X(GetnMapiv) X(GetnPixelMapfv)         \
+    X(GetnPixelMapuiv) X(GetnPixelMapusv) X(GetnPolygonStipple) X(GetnColorTable)                     \
+    X(GetnConvolutionFilter) X(GetnSeparableFilter) X(GetnHistogram) X(GetnMinmax) X(TextureBarrier)  \
+    X(SpecializeShader) X(MultiDrawArraysIndirectCount) X(MultiDrawElementsIndirectCount)             \
+    X(PolygonOffsetClamp)
@@ -0,0 +1,287 @@
+// include/cg101/gl_replay.hpp
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <cg101/gl_trace.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// trace 읽기: 파일 전체를 한 번에 읽고 record를 고정 크기 TraceCmd 배열로 풀어 둔다
+// ------------------------------------------------------------
+//
+// replay 중에는 parsing을 하지 않으므로 측정 시간은 GL 호출 자체의 비용이다.
+
+struct TraceCmd {
+    TraceOp        op = TraceOp::Count;
+    uint32_t       i[9] = {};
+    float          f[4] = {};
+    const uint8_t* blob = nullptr; // Trace::data 안을 가리킨다
+    uint32_t       blobSize = 0;
+};
+
+struct Trace {
+    std::vector<uint8_t>  data;
+    std::vector<TraceCmd> cmds;
+    size_t frameBegin = 0;  // 첫 BeginFrame의 위치 (이전은 setup)
+    size_t frameEnd   = 0;  // 마지막 EndFrame 다음 위치 (이후는 checksum/teardown)
+    int    frames     = 0;
+};
+
+static inline bool loadTrace(const char* path, Trace& t) {
+    FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::fprintf(stderr, "trace: cannot open '%s'\n", path);
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const long size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    t.data.resize(size > 0 ? (size_t)size : 0);
+    const bool readOk = std::fread(t.data.data(), 1, t.data.size(), f) == t.data.size();
+    std::fclose(f);
+
+    auto fail = [&](const char* why, size_t at) {
+        std::fprintf(stderr, "trace: '%s' is malformed (%s at byte %zu)\n", path, why, at);
+        return false;
+    };
+    if (!readOk || t.data.size() < 8 || std::memcmp(t.data.data(), kTraceMagic, 4) != 0)
+        return fail("bad header", 0);
+
+    const uint8_t* p = t.data.data();
+    const size_t   n = t.data.size();
+    auto u32 = [&](size_t at) {
+        return (uint32_t)p[at] | ((uint32_t)p[at + 1] << 8) | ((uint32_t)p[at + 2] << 16) | ((uint32_t)p[at + 3] << 24);
+    };
+    if (u32(4) != kTraceVersion) return fail("unsupported version", 4);
+
+    t.cmds.clear();
+    t.frames = 0;
+    bool seenBegin = false;
+    size_t pos = 8;
+    while (pos < n) {
+        TraceCmd c;
+        c.op = (TraceOp)p[pos];
+        const TraceLayout& L = traceLayout(c.op);
+        if (!L.name) return fail("unknown op", pos);
+        const int ni = L.ints < 9 ? L.ints : 9, nf = L.floats < 4 ? L.floats : 4;
+        ++pos;
+
+        if (pos + 4 * (size_t)(ni + nf) > n) return fail("truncated record", pos);
+        for (int k = 0; k < ni; ++k, pos += 4) c.i[k] = u32(pos);
+        for (int k = 0; k < nf; ++k, pos += 4) {
+            const uint32_t u = u32(pos);
+            std::memcpy(&c.f[k], &u, 4);
+        }
+        if (L.blob) {
+            if (pos + 4 > n) return fail("truncated blob", pos);
+            c.blobSize = u32(pos);
+            pos += 4;
+            if (pos + c.blobSize > n) return fail("truncated blob", pos);
+            c.blob = p + pos;
+            pos += c.blobSize;
+        }
+
+        if (c.op == TraceOp::BeginFrame && !seenBegin) { t.frameBegin = t.cmds.size(); seenBegin = true; }
+        if (c.op == TraceOp::EndFrame) { t.frameEnd = t.cmds.size() + 1; ++t.frames; }
+        t.cmds.push_back(c);
+    }
+    if (!seenBegin) t.frameBegin = t.frameEnd = t.cmds.size();
+    return true;
+}
+
+// ------------------------------------------------------------
+// replay
+// ------------------------------------------------------------
+
+struct TraceOpStats {
+    uint64_t calls = 0;
+    double   ns    = 0.0;
+    double   maxNs = 0.0;
+};
+
+class TracePlayer {
+public:
+    // [begin, end) 구간의 명령을 실행한다. timing == true이면 op별 호출 시간을 누적한다.
+    void run(const Trace& t, size_t begin, size_t end, bool timing) {
+        using clock = std::chrono::steady_clock;
+        for (size_t k = begin; k < end; ++k) {
+            const TraceCmd& c = t.cmds[k];
+            if (!timing) {
+                exec(c);
+                continue;
+            }
+            const auto t0 = clock::now();
+            exec(c);
+            const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count();
+            TraceOpStats& s = stats_[(int)c.op];
+            ++s.calls;
+            s.ns += ns;
+            if (ns > s.maxNs) s.maxNs = ns;
+        }
+    }
+
+    const TraceOpStats& stats(TraceOp op) const { return stats_[(int)op]; }
+    void resetStats() { for (TraceOpStats& s : stats_) s = {}; }
+
+    int checksums() const { return checksums_; }
+    int checksumMismatches() const { return mismatches_; }
+
+private:
+    enum NameKind { kBuffer, kVertexArray, kTexture, kFramebuffer, kShader, kProgram, kNameKinds };
+
+    // capture 시점의 이름 -> replay context의 이름 (0은 항상 0)
+    GLuint name(NameKind k, uint32_t recorded) const {
+        const std::vector<GLuint>& m = names_[k];
+        return recorded < m.size() ? m[recorded] : 0;
+    }
+
+    void setName(NameKind k, uint32_t recorded, GLuint actual) {
+        std::vector<GLuint>& m = names_[k];
+        if (recorded >= m.size()) m.resize((size_t)recorded + 1, 0);
+        m[recorded] = actual;
+    }
+
+    GLint location(uint32_t recordedLoc) const {
+        if ((int32_t)recordedLoc < 0) return -1;
+        auto it = locations_.find(((uint64_t)currentProgram_ << 32) | recordedLoc);
+        return it != locations_.end() ? it->second : -1;
+    }
+
+    template <class GenFn>
+    void gen(const TraceCmd& c, NameKind k, GenFn&& genFn) {
+        const GLsizei n = (GLsizei)(c.blobSize / 4);
+        std::vector<GLuint> fresh((size_t)n);
+        genFn(n, fresh.data());
+        for (GLsizei j = 0; j < n; ++j) {
+            uint32_t rec;
+            std::memcpy(&rec, c.blob + j * 4, 4);
+            setName(k, rec, fresh[(size_t)j]);
+        }
+    }
+
+    template <class DelFn>
+    void del(const TraceCmd& c, NameKind k, DelFn&& delFn) {
+        const GLsizei n = (GLsizei)(c.blobSize / 4);
+        std::vector<GLuint> actual((size_t)n);
+        for (GLsizei j = 0; j < n; ++j) {
+            uint32_t rec;
+            std::memcpy(&rec, c.blob + j * 4, 4);
+            actual[(size_t)j] = name(k, rec);
+            setName(k, rec, 0);
+        }
+        delFn(n, actual.data());
+    }
+
+    void exec(const TraceCmd& c) {
+        const uint32_t* a = c.i;
+        const float*    f = c.f;
+        switch (c.op) {
+        case TraceOp::BeginFrame: break;
+        case TraceOp::EndFrame:   glFinish(); break; // swap 대신: frame의 GPU 작업 완료까지를 frame 시간으로 본다
+        case TraceOp::Checksum: {
+            std::vector<uint8_t> px((size_t)a[2] * a[3] * 4);
+            glFinish();
+            glReadPixels((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3], GL_RGBA, GL_UNSIGNED_BYTE, px.data());
+            const uint64_t expect = (uint64_t)a[4] | ((uint64_t)a[5] << 32);
+            ++checksums_;
+            if (fnv1a64(px.data(), px.size()) != expect) ++mismatches_;
+            break;
+        }
+
+        case TraceOp::GenBuffers:         gen(c, kBuffer,      [](GLsizei n, GLuint* o) { glGenBuffers(n, o); }); break;
+        case TraceOp::DeleteBuffers:      del(c, kBuffer,      [](GLsizei n, GLuint* o) { glDeleteBuffers(n, o); }); break;
+        case TraceOp::GenVertexArrays:    gen(c, kVertexArray, [](GLsizei n, GLuint* o) { glGenVertexArrays(n, o); }); break;
+        case TraceOp::DeleteVertexArrays: del(c, kVertexArray, [](GLsizei n, GLuint* o) { glDeleteVertexArrays(n, o); }); break;
+        case TraceOp::GenTextures:        gen(c, kTexture,     [](GLsizei n, GLuint* o) { glGenTextures(n, o); }); break;
+        case TraceOp::DeleteTextures:     del(c, kTexture,     [](GLsizei n, GLuint* o) { glDeleteTextures(n, o); }); break;
+        case TraceOp::GenFramebuffers:    gen(c, kFramebuffer, [](GLsizei n, GLuint* o) { glGenFramebuffers(n, o); }); break;
+        case TraceOp::DeleteFramebuffers: del(c, kFramebuffer, [](GLsizei n, GLuint* o) { glDeleteFramebuffers(n, o); }); break;
+        case TraceOp::CreateShader:       setName(kShader, a[1], glCreateShader(a[0])); break;
+        case TraceOp::DeleteShader:       glDeleteShader(name(kShader, a[0])); setName(kShader, a[0], 0); break;
+        case TraceOp::CreateProgram:      setName(kProgram, a[0], glCreateProgram()); break;
+        case TraceOp::DeleteProgram:      glDeleteProgram(name(kProgram, a[0])); setName(kProgram, a[0], 0); break;
+
+        case TraceOp::ShaderSource: {
+            const GLchar* src = (const GLchar*)c.blob;
+            const GLint   len = (GLint)c.blobSize;
+            glShaderSource(name(kShader, a[0]), 1, &src, &len);
+            break;
+        }
+        case TraceOp::CompileShader: glCompileShader(name(kShader, a[0])); break;
+        case TraceOp::AttachShader:  glAttachShader(name(kProgram, a[0]), name(kShader, a[1])); break;
+        case TraceOp::LinkProgram:   glLinkProgram(name(kProgram, a[0])); break;
+        case TraceOp::UseProgram:    currentProgram_ = a[0]; glUseProgram(name(kProgram, a[0])); break;
+        case TraceOp::GetUniformLocation: {
+            // blob은 NUL 없이 기록된 이름 전체: 길이 제한 없이 blobSize만큼 복사해 NUL을 붙인다
+            const std::string uname((const char*)c.blob, c.blobSize);
+            if ((int32_t)a[1] >= 0)
+                locations_[((uint64_t)a[0] << 32) | a[1]] = glGetUniformLocation(name(kProgram, a[0]), uname.c_str());
+            break;
+        }
+
+        case TraceOp::Uniform1i:        glUniform1i(location(a[0]), (GLint)a[1]); break;
+        case TraceOp::Uniform1f:        glUniform1f(location(a[0]), f[0]); break;
+        case TraceOp::Uniform2f:        glUniform2f(location(a[0]), f[0], f[1]); break;
+        case TraceOp::Uniform3f:        glUniform3f(location(a[0]), f[0], f[1], f[2]); break;
+        case TraceOp::Uniform4f:        glUniform4f(location(a[0]), f[0], f[1], f[2], f[3]); break;
+        case TraceOp::UniformMatrix2fv: glUniformMatrix2fv(location(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat*)c.blob); break;
+        case TraceOp::UniformMatrix3fv: glUniformMatrix3fv(location(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat*)c.blob); break;
+        case TraceOp::UniformMatrix4fv: glUniformMatrix4fv(location(a[0]), (GLsizei)a[1], (GLboolean)a[2], (const GLfloat*)c.blob); break;
+
+        case TraceOp::BindBuffer:    glBindBuffer(a[0], name(kBuffer, a[1])); break;
+        case TraceOp::BufferData:    glBufferData(a[0], (GLsizeiptr)a[1], a[3] ? c.blob : nullptr, a[2]); break;
+        case TraceOp::BufferSubData: glBufferSubData(a[0], (GLintptr)a[1], (GLsizeiptr)c.blobSize, c.blob); break;
+        case TraceOp::BindVertexArray: glBindVertexArray(name(kVertexArray, a[0])); break;
+        case TraceOp::VertexAttribPointer:
+            glVertexAttribPointer(a[0], (GLint)a[1], a[2], (GLboolean)a[3], (GLsizei)a[4], (const void*)(uintptr_t)a[5]);
+            break;
+        case TraceOp::EnableVertexAttribArray:  glEnableVertexAttribArray(a[0]); break;
+        case TraceOp::DisableVertexAttribArray: glDisableVertexAttribArray(a[0]); break;
+
+        case TraceOp::BindTexture: glBindTexture(a[0], name(kTexture, a[1])); break;
+        case TraceOp::TexImage2D:
+            glTexImage2D(a[0], (GLint)a[1], (GLint)a[2], (GLsizei)a[3], (GLsizei)a[4], (GLint)a[5], a[6], a[7],
+                         a[8] ? c.blob : nullptr);
+            break;
+        case TraceOp::TexParameteri:   glTexParameteri(a[0], a[1], (GLint)a[2]); break;
+        case TraceOp::ActiveTexture:   glActiveTexture(a[0]); break;
+        case TraceOp::PixelStorei:     glPixelStorei(a[0], (GLint)a[1]); break;
+        case TraceOp::BindFramebuffer: glBindFramebuffer(a[0], name(kFramebuffer, a[1])); break;
+        case TraceOp::FramebufferTexture2D:
+            glFramebufferTexture2D(a[0], a[1], a[2], name(kTexture, a[3]), (GLint)a[4]);
+            break;
+
+        case TraceOp::Viewport:   glViewport((GLint)a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+        case TraceOp::ClearColor: glClearColor(f[0], f[1], f[2], f[3]); break;
+        case TraceOp::Clear:      glClear(a[0]); break;
+        case TraceOp::Enable:     glEnable(a[0]); break;
+        case TraceOp::Disable:    glDisable(a[0]); break;
+        case TraceOp::BlendFunc:  glBlendFunc(a[0], a[1]); break;
+
+        case TraceOp::DrawArrays:          glDrawArrays(a[0], (GLint)a[1], (GLsizei)a[2]); break;
+        case TraceOp::DrawElements:        glDrawElements(a[0], (GLsizei)a[1], a[2], (const void*)(uintptr_t)a[3]); break;
+        case TraceOp::DrawArraysInstanced: glDrawArraysInstanced(a[0], (GLint)a[1], (GLsizei)a[2], (GLsizei)a[3]); break;
+
+        default: break;
+        }
+    }
+
+    std::vector<GLuint> names_[kNameKinds];
+    std::unordered_map<uint64_t, GLint> locations_; // (capture program, capture location) -> replay location
+    uint32_t currentProgram_ = 0;                    // capture 시점의 program 이름
+
+    TraceOpStats stats_[(int)TraceOp::Count];
+    int checksums_  = 0;
+    int mismatches_ = 0;
+};
+
+} // namespace cg101
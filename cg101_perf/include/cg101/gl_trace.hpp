@@ -0,0 +1,505 @@
+// include/cg101/gl_trace.hpp
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <cg101/gl_func_list.hpp>
+#include <cg101/gl_util.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// GL command trace: 파일 형식
+// ------------------------------------------------------------
+//
+// header : "CG1T" + version(u32)
+// record : op(u8) + u32 인자 ints개 + f32 인자 floats개 (+ blob: length(u32) + bytes)
+// op별 인자 개수와 blob 유무는 traceLayout() 표가 정하므로 record마다 길이 정보를 따로 두지 않는다.
+// buffer offset/size도 u32로 저장한다 (CH1~CH3 규모의 scene 기준).
+// object 이름(buffer, VAO, shader, ...)과 uniform location은 capture 시점의 값을 그대로 기록하고,
+// replay가 자기 context에서 새로 얻은 값으로 바꿔 쓴다.
+
+static constexpr char     kTraceMagic[4] = { 'C', 'G', '1', 'T' };
+static constexpr uint32_t kTraceVersion  = 1;
+
+enum class TraceOp : uint8_t {
+    // marker
+    BeginFrame = 1, EndFrame, Checksum,
+    // object 생성/삭제 (Gen/Delete의 blob = u32 이름 배열)
+    GenBuffers = 10, DeleteBuffers, GenVertexArrays, DeleteVertexArrays,
+    GenTextures, DeleteTextures, GenFramebuffers, DeleteFramebuffers,
+    CreateShader, DeleteShader, CreateProgram, DeleteProgram,
+    // shader / program
+    ShaderSource = 30, CompileShader, AttachShader, LinkProgram, UseProgram, GetUniformLocation,
+    // uniform
+    Uniform1i = 40, Uniform1f, Uniform2f, Uniform3f, Uniform4f,
+    UniformMatrix2fv, UniformMatrix3fv, UniformMatrix4fv,
+    // buffer / vertex array
+    BindBuffer = 50, BufferData, BufferSubData, BindVertexArray,
+    VertexAttribPointer, EnableVertexAttribArray, DisableVertexAttribArray,
+    // texture / framebuffer
+    BindTexture = 60, TexImage2D, TexParameteri, ActiveTexture, PixelStorei,
+    BindFramebuffer, FramebufferTexture2D,
+    // fixed-function 상태
+    Viewport = 70, ClearColor, Clear, Enable, Disable, BlendFunc,
+    // draw
+    DrawArrays = 80, DrawElements, DrawArraysInstanced,
+
+    Count
+};
+
+struct TraceLayout {
+    const char* name;   // nullptr이면 정의되지 않은 op
+    uint8_t     ints;
+    uint8_t     floats;
+    bool        blob;
+};
+
+static inline const TraceLayout& traceLayout(TraceOp op) {
+    static const TraceLayout kNone = { nullptr, 0, 0, false };
+    static TraceLayout table[(int)TraceOp::Count];
+    static bool init = false;
+    if (!init) {
+        auto set = [](TraceOp o, const char* n, uint8_t i, uint8_t f, bool b) { table[(int)o] = { n, i, f, b }; };
+        set(TraceOp::BeginFrame,               "begin_frame",               0, 0, false);
+        set(TraceOp::EndFrame,                 "end_frame (glFinish)",      0, 0, false);
+        set(TraceOp::Checksum,                 "checksum",                  6, 0, false); // x y w h hashLo hashHi
+        set(TraceOp::GenBuffers,               "glGenBuffers",              0, 0, true);
+        set(TraceOp::DeleteBuffers,            "glDeleteBuffers",           0, 0, true);
+        set(TraceOp::GenVertexArrays,          "glGenVertexArrays",         0, 0, true);
+        set(TraceOp::DeleteVertexArrays,       "glDeleteVertexArrays",      0, 0, true);
+        set(TraceOp::GenTextures,              "glGenTextures",             0, 0, true);
+        set(TraceOp::DeleteTextures,           "glDeleteTextures",          0, 0, true);
+        set(TraceOp::GenFramebuffers,          "glGenFramebuffers",         0, 0, true);
+        set(TraceOp::DeleteFramebuffers,       "glDeleteFramebuffers",      0, 0, true);
+        set(TraceOp::CreateShader,             "glCreateShader",            2, 0, false); // type name
+        set(TraceOp::DeleteShader,             "glDeleteShader",            1, 0, false);
+        set(TraceOp::CreateProgram,            "glCreateProgram",           1, 0, false);
+        set(TraceOp::DeleteProgram,            "glDeleteProgram",           1, 0, false);
+        set(TraceOp::ShaderSource,             "glShaderSource",            1, 0, true);  // shader + source
+        set(TraceOp::CompileShader,            "glCompileShader",           1, 0, false);
+        set(TraceOp::AttachShader,             "glAttachShader",            2, 0, false);
+        set(TraceOp::LinkProgram,              "glLinkProgram",             1, 0, false);
+        set(TraceOp::UseProgram,               "glUseProgram",              1, 0, false);
+        set(TraceOp::GetUniformLocation,       "glGetUniformLocation",      2, 0, true);  // program loc + name
+        set(TraceOp::Uniform1i,                "glUniform1i",               2, 0, false);
+        set(TraceOp::Uniform1f,                "glUniform1f",               1, 1, false);
+        set(TraceOp::Uniform2f,                "glUniform2f",               1, 2, false);
+        set(TraceOp::Uniform3f,                "glUniform3f",               1, 3, false);
+        set(TraceOp::Uniform4f,                "glUniform4f",               1, 4, false);
+        set(TraceOp::UniformMatrix2fv,         "glUniformMatrix2fv",        3, 0, true);  // loc count transpose + floats
+        set(TraceOp::UniformMatrix3fv,         "glUniformMatrix3fv",        3, 0, true);
+        set(TraceOp::UniformMatrix4fv,         "glUniformMatrix4fv",        3, 0, true);
+        set(TraceOp::BindBuffer,               "glBindBuffer",              2, 0, false);
+        set(TraceOp::BufferData,               "glBufferData",              4, 0, true);  // target size usage hasData + data
+        set(TraceOp::BufferSubData,            "glBufferSubData",           2, 0, true);  // target offset + data
+        set(TraceOp::BindVertexArray,          "glBindVertexArray",         1, 0, false);
+        set(TraceOp::VertexAttribPointer,      "glVertexAttribPointer",     6, 0, false); // index size type norm stride offset
+        set(TraceOp::EnableVertexAttribArray,  "glEnableVertexAttribArray", 1, 0, false);
+        set(TraceOp::DisableVertexAttribArray, "glDisableVertexAttribArray",1, 0, false);
+        set(TraceOp::BindTexture,              "glBindTexture",             2, 0, false);
+        set(TraceOp::TexImage2D,               "glTexImage2D",              9, 0, true);  // ... hasData + pixels
+        set(TraceOp::TexParameteri,            "glTexParameteri",           3, 0, false);
+        set(TraceOp::ActiveTexture,            "glActiveTexture",           1, 0, false);
+        set(TraceOp::PixelStorei,              "glPixelStorei",             2, 0, false);
+        set(TraceOp::BindFramebuffer,          "glBindFramebuffer",         2, 0, false);
+        set(TraceOp::FramebufferTexture2D,     "glFramebufferTexture2D",    5, 0, false);
+        set(TraceOp::Viewport,                 "glViewport",                4, 0, false);
+        set(TraceOp::ClearColor,               "glClearColor",              0, 4, false);
+        set(TraceOp::Clear,                    "glClear",                   1, 0, false);
+        set(TraceOp::Enable,                   "glEnable",                  1, 0, false);
+        set(TraceOp::Disable,                  "glDisable",                 1, 0, false);
+        set(TraceOp::BlendFunc,                "glBlendFunc",               2, 0, false);
+        set(TraceOp::DrawArrays,               "glDrawArrays",              3, 0, false);
+        set(TraceOp::DrawElements,             "glDrawElements",            4, 0, false); // mode count type offset
+        set(TraceOp::DrawArraysInstanced,      "glDrawArraysInstanced",     4, 0, false);
+        init = true;
+    }
+    const int i = (int)op;
+    return (i > 0 && i < (int)TraceOp::Count && table[i].name) ? table[i] : kNone;
+}
+
+// packed type(GL_UNSIGNED_SHORT_5_6_5 등)의 pixel 하나 크기. packed가 아니면 0.
+// packed type은 모든 component를 한 값에 담으므로 format의 component 수와 곱하지 않는다.
+static inline int packedPixelBytes(GLenum type) {
+    switch (type) {
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_BYTE_2_3_3_REV:          return 1;
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV:       return 2;
+    case GL_UNSIGNED_INT_8_8_8_8:
+    case GL_UNSIGNED_INT_8_8_8_8_REV:
+    case GL_UNSIGNED_INT_10_10_10_2:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+    case GL_UNSIGNED_INT_24_8:                return 4;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:   return 8;
+    default:                                  return 0;
+    }
+}
+
+// glTexImage2D의 pixel data 크기 (row는 unpack alignment에 맞춰 padding된다)
+static inline size_t texImageBytes(GLsizei w, GLsizei h, GLenum format, GLenum type, GLint alignment) {
+    int pixel = packedPixelBytes(type);
+    if (pixel == 0) {
+        int comps = 4;
+        switch (format) {
+        case GL_RED:  case GL_RED_INTEGER:
+        case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:    comps = 1; break;
+        case GL_RG:   case GL_RG_INTEGER:                 comps = 2; break;
+        case GL_RGB:  case GL_BGR:
+        case GL_RGB_INTEGER: case GL_BGR_INTEGER:         comps = 3; break;
+        default:                                          comps = 4; break;
+        }
+        int bytes = 1;
+        switch (type) {
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: bytes = 2; break;
+        case GL_UNSIGNED_INT:   case GL_INT:   case GL_FLOAT:      bytes = 4; break;
+        default:                                                   bytes = 1; break;
+        }
+        pixel = comps * bytes;
+    }
+    const size_t a   = (size_t)(alignment > 0 ? alignment : 4);
+    const size_t row = ((size_t)w * pixel + a - 1) / a * a;
+    return row * (size_t)h;
+}
+
+class TraceWriter {
+public:
+    TraceWriter() {
+        for (char ch : kTraceMagic) data_.push_back((uint8_t)ch);
+        putU32(kTraceVersion);
+    }
+
+    void emit(TraceOp op, std::initializer_list<uint32_t> ints, std::initializer_list<float> floats = {},
+              const void* blob = nullptr, uint32_t blobSize = 0) {
+        const TraceLayout& L = traceLayout(op);
+        if (ints.size() != L.ints || floats.size() != L.floats) {
+            // record를 빼면 replay가 달라지므로 기록은 실패로 남긴다 (save와 stopTraceCapture가 false)
+            std::fprintf(stderr, "trace: argument count mismatch for %s\n", L.name ? L.name : "?");
+            failed_ = true;
+            return;
+        }
+        data_.push_back((uint8_t)op);
+        for (uint32_t v : ints) putU32(v);
+        for (float v : floats) {
+            uint32_t u;
+            std::memcpy(&u, &v, 4);
+            putU32(u);
+        }
+        if (L.blob) {
+            putU32(blobSize);
+            if (blobSize) data_.insert(data_.end(), (const uint8_t*)blob, (const uint8_t*)blob + blobSize);
+        }
+        ++records_;
+    }
+
+    bool save(const char* path) const {
+        if (failed_) {
+            std::fprintf(stderr, "trace: not writing '%s', records were dropped during capture\n", path);
+            return false;
+        }
+        FILE* f = std::fopen(path, "wb");
+        if (!f) {
+            std::fprintf(stderr, "trace: cannot open '%s' for writing\n", path);
+            return false;
+        }
+        const bool ok = std::fwrite(data_.data(), 1, data_.size(), f) == data_.size();
+        std::fclose(f);
+        if (!ok) std::fprintf(stderr, "trace: write to '%s' failed\n", path);
+        return ok;
+    }
+
+    size_t bytes() const { return data_.size(); }
+    size_t records() const { return records_; }
+    bool ok() const { return !failed_; } // 버려진 record가 없는가
+
+private:
+    void putU32(uint32_t v) {
+        data_.push_back((uint8_t)v);
+        data_.push_back((uint8_t)(v >> 8));
+        data_.push_back((uint8_t)(v >> 16));
+        data_.push_back((uint8_t)(v >> 24));
+    }
+
+    std::vector<uint8_t> data_;
+    size_t records_ = 0;
+    bool   failed_  = false;
+};
+
+// ------------------------------------------------------------
+// Recorder: glad의 함수 포인터를 기록용 thunk로 바꿔 끼운다
+// ------------------------------------------------------------
+//
+// 호출하는 쪽 코드(glBufferData(...) 등)는 그대로 두고, glad_glXxx 포인터만 교체한다.
+// 아래 목록에 있는 호출만 기록된다. 나머지 GL 진입점(gl_func_list.hpp)도 모두 "미기록" thunk로 바꿔 호출 여부를 표시하고,
+// 조회 함수(glGet*, glCheckFramebufferStatus 등)가 아닌 것이 불렸으면 stopTraceCapture()가 그 이름을 출력하고 실패한다.
+
+#define CG101_TRACE_FUNCS(X)                                                                      \
+    X(GenBuffers) X(DeleteBuffers) X(GenVertexArrays) X(DeleteVertexArrays)                       \
+    X(GenTextures) X(DeleteTextures) X(GenFramebuffers) X(DeleteFramebuffers)                     \
+    X(CreateShader) X(DeleteShader) X(CreateProgram) X(DeleteProgram)                             \
+    X(ShaderSource) X(CompileShader) X(AttachShader) X(LinkProgram) X(UseProgram)                 \
+    X(GetUniformLocation) X(Uniform1i) X(Uniform1f) X(Uniform2f) X(Uniform3f) X(Uniform4f)        \
+    X(UniformMatrix2fv) X(UniformMatrix3fv) X(UniformMatrix4fv)                                   \
+    X(BindBuffer) X(BufferData) X(BufferSubData) X(BindVertexArray) X(VertexAttribPointer)        \
+    X(EnableVertexAttribArray) X(DisableVertexAttribArray)                                        \
+    X(BindTexture) X(TexImage2D) X(TexParameteri) X(ActiveTexture) X(PixelStorei)                 \
+    X(BindFramebuffer) X(FramebufferTexture2D)                                                    \
+    X(Viewport) X(ClearColor) X(Clear) X(Enable) X(Disable) X(BlendFunc)                          \
+    X(DrawArrays) X(DrawElements) X(DrawArraysInstanced)
+
+namespace detail {
+
+struct RealGl {
+#define X(n) decltype(glad_gl##n) n = nullptr;
+    CG101_TRACE_FUNCS(X)
+#undef X
+};
+
+static RealGl       gReal;
+static TraceWriter* gTrace = nullptr;
+
+// 기록 목록 밖의 진입점: 불렸다는 표시만 남기고 원래 함수를 호출한다.
+// Slot은 glad_glXxx 전역 포인터의 주소이다. 진입점마다 작은 함수 3개(call/install/uninstall)만 생기고,
+// start/stop은 아래 표를 도는 loop이므로 진입점이 천 개를 넘어도 한 함수가 거대해지지 않는다.
+template <typename F, F* Slot> struct Unlisted;
+template <typename R, typename... A, R (APIENTRYP* Slot)(A...)>
+struct Unlisted<R (APIENTRYP)(A...), Slot> {
+    static inline R (APIENTRYP real)(A...) = nullptr;
+    static inline bool called = false;
+
+    static R APIENTRY call(A... a) {
+        called = true;
+        return real(a...);
+    }
+    static void install() {
+        real   = *Slot;
+        called = false;
+        if (real) *Slot = call; // 로딩되지 않은 진입점은 nullptr 그대로 둔다
+    }
+    static bool uninstall() {
+        *Slot = real;
+        return called;
+    }
+};
+
+struct UnlistedEntry {
+    const char* name;
+    void (*install)();
+    bool (*uninstall)(); // 원래 포인터를 되돌리고, capture 중에 불렸는지 반환
+};
+
+#define X(n) { "gl" #n, &Unlisted<decltype(glad_gl##n), &glad_gl##n>::install, \
+                        &Unlisted<decltype(glad_gl##n), &glad_gl##n>::uninstall },
+static const UnlistedEntry kUnlisted[] = { CG101_GL_ALL_FUNCS(X) };
+#undef X
+
+// 상태를 바꾸지 않는 호출: 기록하지 않아도 replay 결과가 같다.
+// glReadPixels는 pack buffer가 bind되어 있으면 buffer에 쓰지만, 이 repo의 capture 코드는 client memory로만 읽는다.
+static inline bool isQueryFunc(const char* name) {
+    static const char* const kExact[] = { "glCheckFramebufferStatus", "glCheckNamedFramebufferStatus",
+                                          "glReadPixels", "glFinish", "glFlush" };
+    if (std::strncmp(name, "glGet", 5) == 0 || std::strncmp(name, "glIs", 4) == 0) return true;
+    for (const char* e : kExact)
+        if (std::strcmp(name, e) == 0) return true;
+    return false;
+}
+
+static inline void emitNames(TraceOp op, GLsizei n, const GLuint* names) {
+    gTrace->emit(op, {}, {}, names, (uint32_t)(n * sizeof(GLuint)));
+}
+
+static inline uint32_t ptrOffset(const void* p) {
+    return (uint32_t)(uintptr_t)p;
+}
+
+static void APIENTRY traceGenBuffers(GLsizei n, GLuint* b)         { gReal.GenBuffers(n, b); emitNames(TraceOp::GenBuffers, n, b); }
+static void APIENTRY traceDeleteBuffers(GLsizei n, const GLuint* b) { emitNames(TraceOp::DeleteBuffers, n, b); gReal.DeleteBuffers(n, b); }
+static void APIENTRY traceGenVertexArrays(GLsizei n, GLuint* a)     { gReal.GenVertexArrays(n, a); emitNames(TraceOp::GenVertexArrays, n, a); }
+static void APIENTRY traceDeleteVertexArrays(GLsizei n, const GLuint* a) { emitNames(TraceOp::DeleteVertexArrays, n, a); gReal.DeleteVertexArrays(n, a); }
+static void APIENTRY traceGenTextures(GLsizei n, GLuint* t)         { gReal.GenTextures(n, t); emitNames(TraceOp::GenTextures, n, t); }
+static void APIENTRY traceDeleteTextures(GLsizei n, const GLuint* t) { emitNames(TraceOp::DeleteTextures, n, t); gReal.DeleteTextures(n, t); }
+static void APIENTRY traceGenFramebuffers(GLsizei n, GLuint* f)     { gReal.GenFramebuffers(n, f); emitNames(TraceOp::GenFramebuffers, n, f); }
+static void APIENTRY traceDeleteFramebuffers(GLsizei n, const GLuint* f) { emitNames(TraceOp::DeleteFramebuffers, n, f); gReal.DeleteFramebuffers(n, f); }
+
+static GLuint APIENTRY traceCreateShader(GLenum type) {
+    const GLuint sh = gReal.CreateShader(type);
+    gTrace->emit(TraceOp::CreateShader, { type, sh });
+    return sh;
+}
+static void APIENTRY traceDeleteShader(GLuint sh) { gTrace->emit(TraceOp::DeleteShader, { sh }); gReal.DeleteShader(sh); }
+static GLuint APIENTRY traceCreateProgram() {
+    const GLuint prog = gReal.CreateProgram();
+    gTrace->emit(TraceOp::CreateProgram, { prog });
+    return prog;
+}
+static void APIENTRY traceDeleteProgram(GLuint prog) { gTrace->emit(TraceOp::DeleteProgram, { prog }); gReal.DeleteProgram(prog); }
+
+// 여러 문자열은 하나로 이어 붙여 기록한다 (GLSL 입장에서 같은 source)
+static void APIENTRY traceShaderSource(GLuint sh, GLsizei count, const GLchar* const* str, const GLint* len) {
+    std::vector<char> src;
+    for (GLsizei i = 0; i < count; ++i) {
+        const size_t n = (len && len[i] >= 0) ? (size_t)len[i] : std::strlen(str[i]);
+        src.insert(src.end(), str[i], str[i] + n);
+    }
+    gTrace->emit(TraceOp::ShaderSource, { sh }, {}, src.data(), (uint32_t)src.size());
+    gReal.ShaderSource(sh, count, str, len);
+}
+static void APIENTRY traceCompileShader(GLuint sh)              { gTrace->emit(TraceOp::CompileShader, { sh }); gReal.CompileShader(sh); }
+static void APIENTRY traceAttachShader(GLuint prog, GLuint sh)  { gTrace->emit(TraceOp::AttachShader, { prog, sh }); gReal.AttachShader(prog, sh); }
+static void APIENTRY traceLinkProgram(GLuint prog)              { gTrace->emit(TraceOp::LinkProgram, { prog }); gReal.LinkProgram(prog); }
+static void APIENTRY traceUseProgram(GLuint prog)               { gTrace->emit(TraceOp::UseProgram, { prog }); gReal.UseProgram(prog); }
+
+static GLint APIENTRY traceGetUniformLocation(GLuint prog, const GLchar* name) {
+    const GLint loc = gReal.GetUniformLocation(prog, name);
+    gTrace->emit(TraceOp::GetUniformLocation, { prog, (uint32_t)loc }, {}, name, (uint32_t)std::strlen(name));
+    return loc;
+}
+static void APIENTRY traceUniform1i(GLint l, GLint v)                            { gTrace->emit(TraceOp::Uniform1i, { (uint32_t)l, (uint32_t)v }); gReal.Uniform1i(l, v); }
+static void APIENTRY traceUniform1f(GLint l, GLfloat x)                          { gTrace->emit(TraceOp::Uniform1f, { (uint32_t)l }, { x }); gReal.Uniform1f(l, x); }
+static void APIENTRY traceUniform2f(GLint l, GLfloat x, GLfloat y)               { gTrace->emit(TraceOp::Uniform2f, { (uint32_t)l }, { x, y }); gReal.Uniform2f(l, x, y); }
+static void APIENTRY traceUniform3f(GLint l, GLfloat x, GLfloat y, GLfloat z)    { gTrace->emit(TraceOp::Uniform3f, { (uint32_t)l }, { x, y, z }); gReal.Uniform3f(l, x, y, z); }
+static void APIENTRY traceUniform4f(GLint l, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    gTrace->emit(TraceOp::Uniform4f, { (uint32_t)l }, { x, y, z, w });
+    gReal.Uniform4f(l, x, y, z, w);
+}
+static void APIENTRY traceUniformMatrix2fv(GLint l, GLsizei c, GLboolean t, const GLfloat* v) {
+    gTrace->emit(TraceOp::UniformMatrix2fv, { (uint32_t)l, (uint32_t)c, t }, {}, v, (uint32_t)(c * 4 * sizeof(float)));
+    gReal.UniformMatrix2fv(l, c, t, v);
+}
+static void APIENTRY traceUniformMatrix3fv(GLint l, GLsizei c, GLboolean t, const GLfloat* v) {
+    gTrace->emit(TraceOp::UniformMatrix3fv, { (uint32_t)l, (uint32_t)c, t }, {}, v, (uint32_t)(c * 9 * sizeof(float)));
+    gReal.UniformMatrix3fv(l, c, t, v);
+}
+static void APIENTRY traceUniformMatrix4fv(GLint l, GLsizei c, GLboolean t, const GLfloat* v) {
+    gTrace->emit(TraceOp::UniformMatrix4fv, { (uint32_t)l, (uint32_t)c, t }, {}, v, (uint32_t)(c * 16 * sizeof(float)));
+    gReal.UniformMatrix4fv(l, c, t, v);
+}
+
+static void APIENTRY traceBindBuffer(GLenum target, GLuint b) { gTrace->emit(TraceOp::BindBuffer, { target, b }); gReal.BindBuffer(target, b); }
+static void APIENTRY traceBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+    gTrace->emit(TraceOp::BufferData, { target, (uint32_t)size, usage, data != nullptr }, {},
+                 data, data ? (uint32_t)size : 0u);
+    gReal.BufferData(target, size, data, usage);
+}
+static void APIENTRY traceBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    gTrace->emit(TraceOp::BufferSubData, { target, (uint32_t)offset }, {}, data, (uint32_t)size);
+    gReal.BufferSubData(target, offset, size, data);
+}
+static void APIENTRY traceBindVertexArray(GLuint vao) { gTrace->emit(TraceOp::BindVertexArray, { vao }); gReal.BindVertexArray(vao); }
+static void APIENTRY traceVertexAttribPointer(GLuint i, GLint size, GLenum type, GLboolean norm, GLsizei stride, const void* p) {
+    gTrace->emit(TraceOp::VertexAttribPointer, { i, (uint32_t)size, type, norm, (uint32_t)stride, ptrOffset(p) });
+    gReal.VertexAttribPointer(i, size, type, norm, stride, p);
+}
+static void APIENTRY traceEnableVertexAttribArray(GLuint i)  { gTrace->emit(TraceOp::EnableVertexAttribArray, { i }); gReal.EnableVertexAttribArray(i); }
+static void APIENTRY traceDisableVertexAttribArray(GLuint i) { gTrace->emit(TraceOp::DisableVertexAttribArray, { i }); gReal.DisableVertexAttribArray(i); }
+
+static void APIENTRY traceBindTexture(GLenum target, GLuint t) { gTrace->emit(TraceOp::BindTexture, { target, t }); gReal.BindTexture(target, t); }
+static void APIENTRY traceTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei w, GLsizei h,
+                                     GLint border, GLenum format, GLenum type, const void* pixels) {
+    GLint align = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &align);
+    const uint32_t bytes = pixels ? (uint32_t)texImageBytes(w, h, format, type, align) : 0u;
+    gTrace->emit(TraceOp::TexImage2D, { target, (uint32_t)level, (uint32_t)internalFormat, (uint32_t)w, (uint32_t)h,
+                                        (uint32_t)border, format, type, pixels != nullptr }, {}, pixels, bytes);
+    gReal.TexImage2D(target, level, internalFormat, w, h, border, format, type, pixels);
+}
+static void APIENTRY traceTexParameteri(GLenum target, GLenum pname, GLint v) {
+    gTrace->emit(TraceOp::TexParameteri, { target, pname, (uint32_t)v });
+    gReal.TexParameteri(target, pname, v);
+}
+static void APIENTRY traceActiveTexture(GLenum unit)          { gTrace->emit(TraceOp::ActiveTexture, { unit }); gReal.ActiveTexture(unit); }
+static void APIENTRY tracePixelStorei(GLenum pname, GLint v)  { gTrace->emit(TraceOp::PixelStorei, { pname, (uint32_t)v }); gReal.PixelStorei(pname, v); }
+static void APIENTRY traceBindFramebuffer(GLenum target, GLuint fbo) { gTrace->emit(TraceOp::BindFramebuffer, { target, fbo }); gReal.BindFramebuffer(target, fbo); }
+static void APIENTRY traceFramebufferTexture2D(GLenum target, GLenum att, GLenum texTarget, GLuint tex, GLint level) {
+    gTrace->emit(TraceOp::FramebufferTexture2D, { target, att, texTarget, tex, (uint32_t)level });
+    gReal.FramebufferTexture2D(target, att, texTarget, tex, level);
+}
+
+static void APIENTRY traceViewport(GLint x, GLint y, GLsizei w, GLsizei h) {
+    gTrace->emit(TraceOp::Viewport, { (uint32_t)x, (uint32_t)y, (uint32_t)w, (uint32_t)h });
+    gReal.Viewport(x, y, w, h);
+}
+static void APIENTRY traceClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { gTrace->emit(TraceOp::ClearColor, {}, { r, g, b, a }); gReal.ClearColor(r, g, b, a); }
+static void APIENTRY traceClear(GLbitfield mask)             { gTrace->emit(TraceOp::Clear, { mask }); gReal.Clear(mask); }
+static void APIENTRY traceEnable(GLenum cap)                 { gTrace->emit(TraceOp::Enable, { cap }); gReal.Enable(cap); }
+static void APIENTRY traceDisable(GLenum cap)                { gTrace->emit(TraceOp::Disable, { cap }); gReal.Disable(cap); }
+static void APIENTRY traceBlendFunc(GLenum s, GLenum d)      { gTrace->emit(TraceOp::BlendFunc, { s, d }); gReal.BlendFunc(s, d); }
+
+static void APIENTRY traceDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    gTrace->emit(TraceOp::DrawArrays, { mode, (uint32_t)first, (uint32_t)count });
+    gReal.DrawArrays(mode, first, count);
+}
+static void APIENTRY traceDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+    gTrace->emit(TraceOp::DrawElements, { mode, (uint32_t)count, type, ptrOffset(indices) });
+    gReal.DrawElements(mode, count, type, indices);
+}
+static void APIENTRY traceDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+    gTrace->emit(TraceOp::DrawArraysInstanced, { mode, (uint32_t)first, (uint32_t)count, (uint32_t)instances });
+    gReal.DrawArraysInstanced(mode, first, count, instances);
+}
+
+} // namespace detail
+
+// gladLoadGLLoader 이후에 호출. 이후의 GL 호출이 out에 기록된다.
+static inline void startTraceCapture(TraceWriter& out) {
+    if (detail::gTrace) return;
+    detail::gTrace = &out;
+    // 먼저 모든 진입점을 "미기록" thunk로 바꾸고, 기록하는 진입점은 그 위에 기록용 thunk를 덮어쓴다
+    for (const detail::UnlistedEntry& e : detail::kUnlisted) e.install();
+#define X(n) detail::gReal.n = detail::Unlisted<decltype(glad_gl##n), &glad_gl##n>::real; \
+             glad_gl##n = detail::trace##n;
+    CG101_TRACE_FUNCS(X)
+#undef X
+}
+
+// glad 포인터를 원래대로 되돌린다.
+// 기록 목록에 없는, 상태를 바꾸는 GL 호출이 capture 중에 있었거나 인자 개수가 맞지 않아 버려진 record가 있으면 false
+// (그 trace는 replay가 capture와 달라진다).
+static inline bool stopTraceCapture() {
+    if (!detail::gTrace) return true;
+    bool complete = true;
+    for (const detail::UnlistedEntry& e : detail::kUnlisted) {
+        if (e.uninstall() && !detail::isQueryFunc(e.name)) {
+            std::fprintf(stderr, "trace: %s was called during capture but is not recorded (replay would differ)\n", e.name);
+            complete = false;
+        }
+    }
+    if (!detail::gTrace->ok()) complete = false; // emit이 record를 버렸다
+    detail::gTrace = nullptr;
+    return complete;
+}
+
+// CH1 render loop의 한 반복(clear ~ swap)을 frame으로 표시한다. replay는 frame 구간을 반복 실행할 수 있다.
+static inline void traceBeginFrame() {
+    if (detail::gTrace) detail::gTrace->emit(TraceOp::BeginFrame, {});
+}
+
+static inline void traceEndFrame() {
+    if (detail::gTrace) detail::gTrace->emit(TraceOp::EndFrame, {});
+}
+
+// 현재 read framebuffer의 (x, y, w, h) 영역 hash를 기록한다. replay가 같은 영역을 읽어 비교한다.
+static inline uint64_t traceChecksum(int x, int y, int w, int h) {
+    std::vector<uint8_t> px((size_t)w * h * 4);
+    glFinish();
+    glReadPixels(x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, px.data());
+    const uint64_t hash = fnv1a64(px.data(), px.size());
+    if (detail::gTrace)
+        detail::gTrace->emit(TraceOp::Checksum, { (uint32_t)x, (uint32_t)y, (uint32_t)w, (uint32_t)h,
+                                                  (uint32_t)hash, (uint32_t)(hash >> 32) });
+    return hash;
+}
+
+} // namespace cg101
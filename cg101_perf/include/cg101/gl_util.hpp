@@ -0,0 +1,101 @@
+// include/cg101/gl_util.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <glad/glad.h>
+
+namespace cg101 {
+
+// CH1/CH3 샘플의 compileShader/makeProgram과 동일한 동작 (info log 출력)
+static inline GLuint compileShader(GLenum type, const char* src) {
+    GLuint sh = glCreateShader(type);
+    glShaderSource(sh, 1, &src, nullptr);
+    glCompileShader(sh);
+
+    GLint ok = 0;
+    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(sh, 1024, nullptr, log);
+        std::fprintf(stderr, "Shader compile error:\n%s\n", log);
+    }
+
+    return sh;
+}
+
+static inline GLuint linkProgram(GLuint prog) {
+    glLinkProgram(prog);
+
+    GLint ok = 0;
+    glGetProgramiv(prog, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetProgramInfoLog(prog, 1024, nullptr, log);
+        std::fprintf(stderr, "Program link error:\n%s\n", log);
+    }
+    return prog;
+}
+
+static inline GLuint makeProgram(const char* vsSrc, const char* fsSrc) {
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vsSrc);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fsSrc);
+
+    GLuint prog = glCreateProgram();
+    glAttachShader(prog, vs);
+    glAttachShader(prog, fs);
+    linkProgram(prog);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return prog;
+}
+
+// surfaceless context에는 default framebuffer가 없으므로 color attachment 1장짜리 FBO를 만든다
+struct RenderTarget {
+    GLuint fbo   = 0;
+    GLuint color = 0;
+    int    w     = 0;
+    int    h     = 0;
+};
+
+static inline RenderTarget makeRenderTarget(int w, int h, GLenum internalFormat = GL_RGBA8) {
+    RenderTarget rt;
+    rt.w = w;
+    rt.h = h;
+
+    glGenTextures(1, &rt.color);
+    glBindTexture(GL_TEXTURE_2D, rt.color);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &rt.fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, rt.color, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        std::fprintf(stderr, "Framebuffer incomplete! (%dx%d)\n", w, h);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return rt;
+}
+
+static inline void destroyRenderTarget(RenderTarget& rt) {
+    glDeleteFramebuffers(1, &rt.fbo);
+    glDeleteTextures(1, &rt.color);
+    rt = {};
+}
+
+// 64-bit FNV-1a: readback 이미지가 서로(또는 기록된 trace와) 같은지 비교하는 데 사용
+static inline uint64_t fnv1a64(const void* data, size_t n) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < n; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+} // namespace cg101
@@ -0,0 +1,231 @@
+// include/cg101/mesh_kernels.hpp
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <cg101/parallel.hpp>
+#include <cg101/vec.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// Face kernel: indexed mesh 전체의 face normal / area / flag
+// ------------------------------------------------------------
+
+enum FaceFlags : uint8_t {
+    kFaceDegenerate = 1u << 0, // 두 edge가 거의 평행하거나 길이 0 (sin(theta) <= degenerateSin)
+    kFaceBackFacing = 1u << 1, // dot(n, ref) < 0. 2D mesh(z=0)에서 ref=+Z이면 CW winding
+};
+
+struct FaceData {
+    std::vector<float>   nx, ny, nz; // unit normal (degenerate면 0)
+    std::vector<float>   area;       // |e1 x e2| / 2
+    std::vector<uint8_t> flags;
+
+    void resize(size_t n) {
+        nx.resize(n); ny.resize(n); nz.resize(n);
+        area.resize(n);
+        flags.resize(n);
+    }
+};
+
+struct FaceParams {
+    Vec3  ref           = { 0.0f, 0.0f, 1.0f };
+    float degenerateSin = 1e-6f;
+};
+
+// triangle 하나: CH2-3과 같은 sub + cross + normalize
+static inline void computeFaceScalar(const float* pos, const uint32_t* tri, const FaceParams& prm,
+                                     float& nx, float& ny, float& nz, float& area, uint8_t& flags) {
+    const float* v0 = pos + (size_t)tri[0] * 3;
+    const float* v1 = pos + (size_t)tri[1] * 3;
+    const float* v2 = pos + (size_t)tri[2] * 3;
+    const Vec3 p0 = { v0[0], v0[1], v0[2] };
+    const Vec3 p1 = { v1[0], v1[1], v1[2] };
+    const Vec3 p2 = { v2[0], v2[1], v2[2] };
+
+    const Vec3 e1 = sub(p1, p0);
+    const Vec3 e2 = sub(p2, p0);
+    const Vec3 n  = cross(e1, e2);
+
+    // |e1 x e2| = |e1||e2| sin(theta) 이므로 길이 제곱끼리 비교하면 scale에 무관한 판정이 된다
+    const float nn = dot(n, n);
+    const float s2 = prm.degenerateSin * prm.degenerateSin;
+    const bool degenerate = nn <= s2 * dot(e1, e1) * dot(e2, e2);
+
+    const Vec3 nh = degenerate ? Vec3{ 0.0f, 0.0f, 0.0f } : normalize(n);
+    nx = nh.x; ny = nh.y; nz = nh.z;
+    area  = 0.5f * std::sqrt(nn);
+    flags = (uint8_t)((degenerate ? kFaceDegenerate : 0) | (dot(n, prm.ref) < 0.0f ? kFaceBackFacing : 0));
+}
+
+static inline void computeFacesScalar(const float* pos, const uint32_t* idx, size_t begin, size_t end,
+                                      const FaceParams& prm, FaceData& out) {
+    for (size_t f = begin; f < end; ++f)
+        computeFaceScalar(pos, idx + f * 3, prm, out.nx[f], out.ny[f], out.nz[f], out.area[f], out.flags[f]);
+}
+
+// AVX2: triangle 8개를 한 번에. index로 position을 gather해 SoA register로 만든 뒤 같은 식을 계산한다.
+// gather offset(v*3)은 int32이므로 vertex 번호가 kSimdMaxVertex를 넘는 묶음은 scalar 경로로 처리한다.
+static constexpr uint32_t kSimdMaxVertex = 0x7FFFFFFFu / 3u;
+
+static inline void computeFacesSimd(const float* pos, const uint32_t* idx, size_t begin, size_t end,
+                                    const FaceParams& prm, FaceData& out) {
+    size_t f = begin;
+
+#if defined(__AVX2__)
+    const __m256i three  = _mm256_set1_epi32(3);
+    const __m256i lane3  = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21); // 8개 triangle의 index 간격
+    const __m256  rx     = _mm256_set1_ps(prm.ref.x);
+    const __m256  ry     = _mm256_set1_ps(prm.ref.y);
+    const __m256  rz     = _mm256_set1_ps(prm.ref.z);
+    const __m256  s2     = _mm256_set1_ps(prm.degenerateSin * prm.degenerateSin);
+    const __m256  half   = _mm256_set1_ps(0.5f);
+    const __m256  zero   = _mm256_setzero_ps();
+    const __m256i vmax   = _mm256_set1_epi32((int)kSimdMaxVertex);
+
+    for (; f + 8 <= end; f += 8) {
+        const int* tri = (const int*)(idx + f * 3);
+        const __m256i v0 = _mm256_i32gather_epi32(tri + 0, lane3, 4);
+        const __m256i v1 = _mm256_i32gather_epi32(tri + 1, lane3, 4);
+        const __m256i v2 = _mm256_i32gather_epi32(tri + 2, lane3, 4);
+
+        // unsigned max가 한도 그대로이면 모든 번호가 한도 이하
+        const __m256i top = _mm256_max_epu32(_mm256_max_epu32(_mm256_max_epu32(v0, v1), v2), vmax);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(top, vmax)) != -1) {
+            computeFacesScalar(pos, idx, f, f + 8, prm, out);
+            continue;
+        }
+
+        // 꼭짓점 번호 -> float offset (v*3)
+        const __m256i i0 = _mm256_mullo_epi32(v0, three);
+        const __m256i i1 = _mm256_mullo_epi32(v1, three);
+        const __m256i i2 = _mm256_mullo_epi32(v2, three);
+
+        const __m256 p0x = _mm256_i32gather_ps(pos + 0, i0, 4);
+        const __m256 p0y = _mm256_i32gather_ps(pos + 1, i0, 4);
+        const __m256 p0z = _mm256_i32gather_ps(pos + 2, i0, 4);
+
+        const __m256 e1x = _mm256_sub_ps(_mm256_i32gather_ps(pos + 0, i1, 4), p0x);
+        const __m256 e1y = _mm256_sub_ps(_mm256_i32gather_ps(pos + 1, i1, 4), p0y);
+        const __m256 e1z = _mm256_sub_ps(_mm256_i32gather_ps(pos + 2, i1, 4), p0z);
+        const __m256 e2x = _mm256_sub_ps(_mm256_i32gather_ps(pos + 0, i2, 4), p0x);
+        const __m256 e2y = _mm256_sub_ps(_mm256_i32gather_ps(pos + 1, i2, 4), p0y);
+        const __m256 e2z = _mm256_sub_ps(_mm256_i32gather_ps(pos + 2, i2, 4), p0z);
+
+        // cross(e1, e2)
+        const __m256 nx = _mm256_sub_ps(_mm256_mul_ps(e1y, e2z), _mm256_mul_ps(e1z, e2y));
+        const __m256 ny = _mm256_sub_ps(_mm256_mul_ps(e1z, e2x), _mm256_mul_ps(e1x, e2z));
+        const __m256 nz = _mm256_sub_ps(_mm256_mul_ps(e1x, e2y), _mm256_mul_ps(e1y, e2x));
+
+        const __m256 nn  = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, nx), _mm256_mul_ps(ny, ny)), _mm256_mul_ps(nz, nz));
+        const __m256 ee1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, e1x), _mm256_mul_ps(e1y, e1y)), _mm256_mul_ps(e1z, e1z));
+        const __m256 ee2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, e2x), _mm256_mul_ps(e2y, e2y)), _mm256_mul_ps(e2z, e2z));
+        const __m256 degenerate = _mm256_cmp_ps(nn, _mm256_mul_ps(s2, _mm256_mul_ps(ee1, ee2)), _CMP_LE_OQ);
+
+        const __m256 len = _mm256_sqrt_ps(nn);
+        // scalar normalize()와 같은 n / len. degenerate lane은 0으로 (0으로 나눈 lane은 andnot으로 지운다)
+        _mm256_storeu_ps(&out.nx[f], _mm256_andnot_ps(degenerate, _mm256_div_ps(nx, len)));
+        _mm256_storeu_ps(&out.ny[f], _mm256_andnot_ps(degenerate, _mm256_div_ps(ny, len)));
+        _mm256_storeu_ps(&out.nz[f], _mm256_andnot_ps(degenerate, _mm256_div_ps(nz, len)));
+        _mm256_storeu_ps(&out.area[f], _mm256_mul_ps(len, half));
+
+        const __m256 facing = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, rx), _mm256_mul_ps(ny, ry)), _mm256_mul_ps(nz, rz));
+        const int degMask  = _mm256_movemask_ps(degenerate);
+        const int backMask = _mm256_movemask_ps(_mm256_cmp_ps(facing, zero, _CMP_LT_OQ));
+        for (int l = 0; l < 8; ++l) {
+            out.flags[f + l] = (uint8_t)(((degMask >> l) & 1) * kFaceDegenerate |
+                                         ((backMask >> l) & 1) * kFaceBackFacing);
+        }
+    }
+#endif
+
+    computeFacesScalar(pos, idx, f, end, prm, out); // tail (또는 AVX2가 없는 경우 전체)
+}
+
+static inline void computeFaces(const float* pos, const uint32_t* idx, size_t triCount,
+                                FaceData& out, const FaceParams& prm = {}, unsigned threads = 0) {
+    out.resize(triCount);
+    parallelFor(0, triCount, [&](size_t b, size_t e, unsigned) {
+        computeFacesSimd(pos, idx, b, e, prm, out);
+    }, threads);
+}
+
+// ------------------------------------------------------------
+// Vertex normal: area-weighted 평균, 결정적(deterministic) reduction
+// ------------------------------------------------------------
+//
+// face마다 세 꼭짓점에 더하는 scatter 방식은 thread 간 충돌(atomic)이 생기고, float 덧셈 순서가
+// 실행마다 달라져 결과 bit가 흔들린다. 대신 vertex -> face 인접 목록(CSR)을 한 번 만들고,
+// 각 vertex가 자기 face들을 "face 번호 오름차순"으로 gather한다. 덧셈 순서가 thread 수와 무관하게
+// 고정되므로 결과가 항상 같고, 단일 thread scatter(face 순서)와도 같은 순서이다.
+
+struct VertexAdjacency {
+    std::vector<uint32_t> start; // size = vertexCount + 1
+    std::vector<uint32_t> faces; // size = triCount * 3, vertex별로 face 번호 오름차순
+};
+
+static inline void buildVertexAdjacency(const uint32_t* idx, size_t triCount, size_t vertexCount,
+                                        VertexAdjacency& adj) {
+    adj.start.assign(vertexCount + 1, 0);
+    for (size_t i = 0; i < triCount * 3; ++i) ++adj.start[idx[i] + 1];
+    for (size_t v = 0; v < vertexCount; ++v) adj.start[v + 1] += adj.start[v];
+
+    adj.faces.resize(triCount * 3);
+    std::vector<uint32_t> cursor(adj.start.begin(), adj.start.end() - 1);
+    for (size_t f = 0; f < triCount; ++f) {
+        adj.faces[cursor[idx[f * 3 + 0]]++] = (uint32_t)f;
+        adj.faces[cursor[idx[f * 3 + 1]]++] = (uint32_t)f;
+        adj.faces[cursor[idx[f * 3 + 2]]++] = (uint32_t)f;
+    }
+}
+
+// outNormals: vertexCount x 3 (xyz). 인접 face가 모두 degenerate이면 0
+static inline void computeVertexNormals(const FaceData& faces, const VertexAdjacency& adj,
+                                        size_t vertexCount, float* outNormals, unsigned threads = 0) {
+    parallelFor(0, vertexCount, [&](size_t b, size_t e, unsigned) {
+        for (size_t v = b; v < e; ++v) {
+            Vec3 acc = { 0.0f, 0.0f, 0.0f };
+            for (uint32_t k = adj.start[v]; k < adj.start[v + 1]; ++k) {
+                const uint32_t f = adj.faces[k];
+                const float a = faces.area[f]; // unit normal * area = area-weighted
+                acc.x += faces.nx[f] * a;
+                acc.y += faces.ny[f] * a;
+                acc.z += faces.nz[f] * a;
+            }
+            const Vec3 n = normalize(acc);
+            outNormals[v * 3 + 0] = n.x;
+            outNormals[v * 3 + 1] = n.y;
+            outNormals[v * 3 + 2] = n.z;
+        }
+    }, threads);
+}
+
+// 기준 구현: face 순서대로 세 꼭짓점에 scatter (단일 thread)
+static inline void computeVertexNormalsScatter(const FaceData& faces, const uint32_t* idx, size_t triCount,
+                                               size_t vertexCount, float* outNormals) {
+    std::vector<Vec3> acc(vertexCount, Vec3{ 0.0f, 0.0f, 0.0f });
+    for (size_t f = 0; f < triCount; ++f) {
+        const float a = faces.area[f];
+        for (int c = 0; c < 3; ++c) {
+            Vec3& dst = acc[idx[f * 3 + c]];
+            dst.x += faces.nx[f] * a;
+            dst.y += faces.ny[f] * a;
+            dst.z += faces.nz[f] * a;
+        }
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        const Vec3 n = normalize(acc[v]);
+        outNormals[v * 3 + 0] = n.x;
+        outNormals[v * 3 + 1] = n.y;
+        outNormals[v * 3 + 2] = n.z;
+    }
+}
+
+} // namespace cg101
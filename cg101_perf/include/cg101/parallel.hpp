@@ -0,0 +1,54 @@
+// include/cg101/parallel.hpp
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace cg101 {
+
+static inline unsigned workerCount() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n ? n : 1u;
+}
+
+// [begin, end)를 threads개의 연속 구간으로 나눠 fn(chunkBegin, chunkEnd, chunkIndex)를 병렬 실행한다.
+// 구간 경계는 align의 배수로 맞춘다 (SIMD lane 수에 맞추면 tail 처리가 마지막 구간에만 생긴다).
+// 구간 분할은 입력 크기와 thread 수만으로 결정되므로, chunk별 부분합을 chunkIndex 순서로 합치면
+// 실행 순서와 무관하게 같은 결과(deterministic reduction)가 나온다.
+template <class Fn>
+static void parallelFor(size_t begin, size_t end, Fn&& fn, unsigned threads = 0, size_t align = 8) {
+    if (end <= begin) return;
+    if (threads == 0) threads = workerCount();
+
+    const size_t n = end - begin;
+    size_t chunk = (n + threads - 1) / threads;
+    chunk = (chunk + align - 1) / align * align;
+    const unsigned chunks = (unsigned)((n + chunk - 1) / chunk);
+
+    if (chunks <= 1) {
+        fn(begin, end, 0u);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(chunks - 1);
+    for (unsigned c = 1; c < chunks; ++c) {
+        const size_t b = begin + c * chunk;
+        const size_t e = std::min(end, b + chunk);
+        pool.emplace_back([&fn, b, e, c]() { fn(b, e, c); });
+    }
+    fn(begin, std::min(end, begin + chunk), 0u); // 첫 구간은 호출 thread가 직접 처리
+    for (std::thread& t : pool) t.join();
+}
+
+// parallelFor가 만들 chunk 개수 (chunk별 부분 결과 배열의 크기를 잡을 때 사용)
+static inline unsigned parallelChunkCount(size_t n, unsigned threads = 0, size_t align = 8) {
+    if (n == 0) return 0;
+    if (threads == 0) threads = workerCount();
+    size_t chunk = (n + threads - 1) / threads;
+    chunk = (chunk + align - 1) / align * align;
+    return (unsigned)((n + chunk - 1) / chunk);
+}
+
+} // namespace cg101
@@ -0,0 +1,209 @@
+// include/cg101/particles.hpp
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <cg101/parallel.hpp>
+
+namespace cg101 {
+
+// 2D particle 상태를 SoA(Structure of Arrays)로 저장한다.
+// particle 하나의 필드가 흩어지는 대신, 같은 필드가 연속 메모리에 모여 SIMD 한 번에 8개(AVX)/4개(SSE)를 처리한다.
+struct ParticleSoA {
+    std::vector<float> px, py;   // position
+    std::vector<float> vx, vy;   // velocity
+    std::vector<float> life;     // 남은 수명 (0 이하가 되면 respawn)
+    std::vector<float> svx, svy; // respawn 시 초기 속도 (particle마다 고정)
+
+    size_t size() const { return px.size(); }
+
+    void resize(size_t n) {
+        px.resize(n); py.resize(n);
+        vx.resize(n); vy.resize(n);
+        life.resize(n);
+        svx.resize(n); svy.resize(n);
+    }
+};
+
+// 한 step의 규칙 (CPU/GPU 경로가 같은 순서로 계산한다)
+//   v <- rotate(v, omega*dt)       : CH2-5의 2D 회전 (swirl)
+//   v <- (v + g*dt) * damping
+//   p <- p + v*dt
+//   life <- life - dt; life <= 0 이면 p = emitter, v = spawn velocity, life += lifetime
+struct ParticleParams {
+    float dt       = 1.0f / 60.0f;
+    float gx       = 0.0f;
+    float gy       = -0.8f;
+    float damping  = 0.995f;
+    float omega    = 0.6f;  // rad/s
+    float lifetime = 3.0f;  // s
+    float emitX    = 0.0f;
+    float emitY    = -0.5f;
+};
+
+// 정수 hash -> [0,1) (초기화 전용, 결정적)
+static inline float hash01(uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352du;
+    x ^= x >> 15; x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// 위쪽 부채꼴 방향으로 발사, 수명은 [0, lifetime)에 고르게 퍼뜨려 방출이 연속적으로 보이게 한다
+static inline void initParticles(ParticleSoA& p, size_t n, const ParticleParams& prm, uint32_t seed = 1u) {
+    p.resize(n);
+    constexpr float pi = 3.14159265358979323846f;
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t h = (uint32_t)i * 3u + seed * 0x9E3779B9u;
+        const float theta = pi * 0.5f + (hash01(h) - 0.5f) * (pi / 3.0f); // 90 +- 30 deg
+        const float speed = 0.8f + 0.6f * hash01(h + 1u);
+
+        p.svx[i] = std::cos(theta) * speed;
+        p.svy[i] = std::sin(theta) * speed;
+        p.px[i]  = prm.emitX;
+        p.py[i]  = prm.emitY;
+        p.vx[i]  = p.svx[i];
+        p.vy[i]  = p.svy[i];
+        p.life[i] = prm.lifetime * hash01(h + 2u);
+    }
+}
+
+// 기준 구현: 한 particle씩 scalar로 계산
+static inline void integrateScalar(ParticleSoA& p, size_t begin, size_t end, const ParticleParams& prm) {
+    const float c = std::cos(prm.omega * prm.dt);
+    const float s = std::sin(prm.omega * prm.dt);
+    const float gdx = prm.gx * prm.dt;
+    const float gdy = prm.gy * prm.dt;
+
+    for (size_t i = begin; i < end; ++i) {
+        float vx = p.vx[i] * c - p.vy[i] * s;
+        float vy = p.vx[i] * s + p.vy[i] * c;
+        vx = (vx + gdx) * prm.damping;
+        vy = (vy + gdy) * prm.damping;
+
+        float px = p.px[i] + vx * prm.dt;
+        float py = p.py[i] + vy * prm.dt;
+        float life = p.life[i] - prm.dt;
+
+        if (life <= 0.0f) {
+            px = prm.emitX;
+            py = prm.emitY;
+            vx = p.svx[i];
+            vy = p.svy[i];
+            life += prm.lifetime;
+        }
+
+        p.px[i] = px; p.py[i] = py;
+        p.vx[i] = vx; p.vy[i] = vy;
+        p.life[i] = life;
+    }
+}
+
+// SIMD 구현: respawn 분기를 compare mask + blend로 바꿔 lane 전체를 branch 없이 처리한다
+static inline void integrateSimd(ParticleSoA& p, size_t begin, size_t end, const ParticleParams& prm) {
+    size_t i = begin;
+
+#if defined(__AVX__)
+    {
+        const __m256 c    = _mm256_set1_ps(std::cos(prm.omega * prm.dt));
+        const __m256 s    = _mm256_set1_ps(std::sin(prm.omega * prm.dt));
+        const __m256 gdx  = _mm256_set1_ps(prm.gx * prm.dt);
+        const __m256 gdy  = _mm256_set1_ps(prm.gy * prm.dt);
+        const __m256 damp = _mm256_set1_ps(prm.damping);
+        const __m256 dt   = _mm256_set1_ps(prm.dt);
+        const __m256 ex   = _mm256_set1_ps(prm.emitX);
+        const __m256 ey   = _mm256_set1_ps(prm.emitY);
+        const __m256 lt   = _mm256_set1_ps(prm.lifetime);
+        const __m256 zero = _mm256_setzero_ps();
+
+        for (; i + 8 <= end; i += 8) {
+            const __m256 vx0 = _mm256_loadu_ps(&p.vx[i]);
+            const __m256 vy0 = _mm256_loadu_ps(&p.vy[i]);
+
+            __m256 vx = _mm256_sub_ps(_mm256_mul_ps(vx0, c), _mm256_mul_ps(vy0, s));
+            __m256 vy = _mm256_add_ps(_mm256_mul_ps(vx0, s), _mm256_mul_ps(vy0, c));
+            vx = _mm256_mul_ps(_mm256_add_ps(vx, gdx), damp);
+            vy = _mm256_mul_ps(_mm256_add_ps(vy, gdy), damp);
+
+            __m256 px   = _mm256_add_ps(_mm256_loadu_ps(&p.px[i]), _mm256_mul_ps(vx, dt));
+            __m256 py   = _mm256_add_ps(_mm256_loadu_ps(&p.py[i]), _mm256_mul_ps(vy, dt));
+            __m256 life = _mm256_sub_ps(_mm256_loadu_ps(&p.life[i]), dt);
+
+            const __m256 dead = _mm256_cmp_ps(life, zero, _CMP_LE_OQ);
+            px   = _mm256_blendv_ps(px, ex, dead);
+            py   = _mm256_blendv_ps(py, ey, dead);
+            vx   = _mm256_blendv_ps(vx, _mm256_loadu_ps(&p.svx[i]), dead);
+            vy   = _mm256_blendv_ps(vy, _mm256_loadu_ps(&p.svy[i]), dead);
+            life = _mm256_add_ps(life, _mm256_and_ps(dead, lt));
+
+            _mm256_storeu_ps(&p.px[i], px);
+            _mm256_storeu_ps(&p.py[i], py);
+            _mm256_storeu_ps(&p.vx[i], vx);
+            _mm256_storeu_ps(&p.vy[i], vy);
+            _mm256_storeu_ps(&p.life[i], life);
+        }
+    }
+#elif defined(__SSE2__)
+    {
+        const __m128 c    = _mm_set1_ps(std::cos(prm.omega * prm.dt));
+        const __m128 s    = _mm_set1_ps(std::sin(prm.omega * prm.dt));
+        const __m128 gdx  = _mm_set1_ps(prm.gx * prm.dt);
+        const __m128 gdy  = _mm_set1_ps(prm.gy * prm.dt);
+        const __m128 damp = _mm_set1_ps(prm.damping);
+        const __m128 dt   = _mm_set1_ps(prm.dt);
+        const __m128 ex   = _mm_set1_ps(prm.emitX);
+        const __m128 ey   = _mm_set1_ps(prm.emitY);
+        const __m128 lt   = _mm_set1_ps(prm.lifetime);
+        const __m128 zero = _mm_setzero_ps();
+
+        // SSE2에는 blendv가 없으므로 (a & ~m) | (b & m)
+        auto select = [](__m128 a, __m128 b, __m128 m) {
+            return _mm_or_ps(_mm_andnot_ps(m, a), _mm_and_ps(m, b));
+        };
+
+        for (; i + 4 <= end; i += 4) {
+            const __m128 vx0 = _mm_loadu_ps(&p.vx[i]);
+            const __m128 vy0 = _mm_loadu_ps(&p.vy[i]);
+
+            __m128 vx = _mm_sub_ps(_mm_mul_ps(vx0, c), _mm_mul_ps(vy0, s));
+            __m128 vy = _mm_add_ps(_mm_mul_ps(vx0, s), _mm_mul_ps(vy0, c));
+            vx = _mm_mul_ps(_mm_add_ps(vx, gdx), damp);
+            vy = _mm_mul_ps(_mm_add_ps(vy, gdy), damp);
+
+            __m128 px   = _mm_add_ps(_mm_loadu_ps(&p.px[i]), _mm_mul_ps(vx, dt));
+            __m128 py   = _mm_add_ps(_mm_loadu_ps(&p.py[i]), _mm_mul_ps(vy, dt));
+            __m128 life = _mm_sub_ps(_mm_loadu_ps(&p.life[i]), dt);
+
+            const __m128 dead = _mm_cmple_ps(life, zero);
+            px   = select(px, ex, dead);
+            py   = select(py, ey, dead);
+            vx   = select(vx, _mm_loadu_ps(&p.svx[i]), dead);
+            vy   = select(vy, _mm_loadu_ps(&p.svy[i]), dead);
+            life = _mm_add_ps(life, _mm_and_ps(dead, lt));
+
+            _mm_storeu_ps(&p.px[i], px);
+            _mm_storeu_ps(&p.py[i], py);
+            _mm_storeu_ps(&p.vx[i], vx);
+            _mm_storeu_ps(&p.vy[i], vy);
+            _mm_storeu_ps(&p.life[i], life);
+        }
+    }
+#endif
+
+    integrateScalar(p, i, end, prm); // tail
+}
+
+// 멀티스레드 + SIMD: particle 사이에 의존성이 없으므로 구간만 나누면 된다
+static inline void integrateParallel(ParticleSoA& p, const ParticleParams& prm, unsigned threads = 0) {
+    parallelFor(0, p.size(), [&](size_t b, size_t e, unsigned) {
+        integrateSimd(p, b, e, prm);
+    }, threads);
+}
+
+} // namespace cg101
@@ -0,0 +1,385 @@
+// include/cg101/render_graph.hpp
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <cg101/gl_util.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// 선언형 render graph
+// ------------------------------------------------------------
+//
+// pass는 "무엇을 읽고(reads) 어디에 그리는지(target)"만 선언하고, 실제 GL 호출은 execute 콜백이 한다.
+// compile()은
+//   1) 최종 출력에 기여하지 않는 pass를 제거(cull)하고
+//   2) 의존 관계를 지키는 실행 순서를 정하고 (같은 target을 쓰는 pass를 이어 붙여 FBO 재바인딩을 줄임)
+//   3) 수명이 겹치지 않는 transient texture를 같은 physical texture에 배정(aliasing)한다.
+// GL에는 Vulkan/D3D12의 memory heap이 없으므로, aliasing 단위는 크기/format이 같은 texture 객체의 재사용이다.
+
+using ResourceId = int;
+static constexpr ResourceId kNoResource = -1;
+
+struct TextureDesc {
+    int    w      = 0;
+    int    h      = 0;
+    GLenum format = GL_RGBA8;
+};
+
+static inline bool operator==(const TextureDesc& a, const TextureDesc& b) {
+    return a.w == b.w && a.h == b.h && a.format == b.format;
+}
+
+static inline size_t texelBytes(GLenum format) {
+    switch (format) {
+    case GL_R8:             return 1;
+    case GL_RG8:
+    case GL_R16F:           return 2;
+    case GL_RGBA8:
+    case GL_RGB10_A2:
+    case GL_R11F_G11F_B10F:
+    case GL_RG16F:
+    case GL_R32F:           return 4;
+    case GL_RGBA16F:
+    case GL_RG32F:          return 8;
+    case GL_RGBA32F:        return 16;
+    default:                return 4;
+    }
+}
+
+static inline size_t textureBytes(const TextureDesc& d) {
+    return (size_t)d.w * (size_t)d.h * texelBytes(d.format);
+}
+
+// execute 콜백에 전달: target FBO는 이미 bind되어 있고 viewport도 target 크기로 설정되어 있다
+struct PassContext {
+    int width  = 0;
+    int height = 0;
+    const std::vector<GLuint>* textures = nullptr;
+
+    // resource의 현재 color texture (aliasing 결과 다른 resource와 같은 이름일 수 있다)
+    GLuint texture(ResourceId id) const { return (*textures)[id]; }
+};
+
+struct PassDesc {
+    std::string             name;
+    std::vector<ResourceId> reads;                 // sampler로 읽는 resource
+    ResourceId              target = kNoResource;  // color attachment (pass당 1장, CH1/CH3과 같은 단일 출력)
+    bool                    keepContents = false;  // true: 기존 내용 위에 그림 (blend). false: target 전체를 덮어씀
+    bool                    sideEffect   = false;  // 아무도 결과를 읽지 않아도 cull하지 않음 (readback 등)
+    std::function<void(const PassContext&)> execute;
+};
+
+struct RenderGraphOptions {
+    bool cull         = true;
+    bool reorder      = true;
+    bool alias        = true;
+    bool elideRebinds = true;  // false: pass마다 bind -> draw -> bind(0) (CH1의 render loop 방식)
+};
+
+struct RenderGraphStats {
+    int    passes            = 0;
+    int    culledPasses      = 0;
+    int    transientTextures = 0;  // 살아남은 pass가 사용하는 transient resource 수
+    int    physicalTextures  = 0;  // 실제 할당한 texture 수
+    size_t transientBytes    = 0;  // aliasing 없이 필요했을 크기
+    size_t physicalBytes     = 0;  // 실제 할당 크기 (= transient 전용 peak memory)
+    int    fboBinds          = 0;  // 마지막 execute()의 glBindFramebuffer 호출 수 (elideRebinds == false이면 bind(0) 포함)
+    int    targetChanges     = 0;  // 마지막 execute()에서 직전 pass와 다른 FBO로 바뀐 횟수 (첫 pass 포함)
+};
+
+class RenderGraph {
+public:
+    RenderGraph() = default;
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+    ~RenderGraph() { release(); }
+
+    // graph가 수명을 관리하는 중간 결과 texture
+    ResourceId createTexture(const char* name, TextureDesc desc) {
+        Resource r;
+        r.name = name;
+        r.desc = desc;
+        resources_.push_back(r);
+        return (ResourceId)resources_.size() - 1;
+    }
+
+    // 외부에서 만든 render target (최종 출력, 다음 frame까지 유지되는 history 등). aliasing 대상이 아니다.
+    ResourceId importTarget(const char* name, const RenderTarget& rt) {
+        Resource r;
+        r.name     = name;
+        r.desc     = { rt.w, rt.h, GL_NONE };
+        r.imported = true;
+        r.rt       = rt;
+        resources_.push_back(r);
+        return (ResourceId)resources_.size() - 1;
+    }
+
+    // 이 resource의 마지막 내용이 graph의 결과이다 (cull의 시작점)
+    void markOutput(ResourceId id) { resources_[id].output = true; }
+
+    int addPass(PassDesc pass) {
+        passes_.push_back(std::move(pass));
+        return (int)passes_.size() - 1;
+    }
+
+    bool compile(const RenderGraphOptions& opt = {}) {
+        release();
+        opt_   = opt;
+        stats_ = {};
+        stats_.passes = (int)passes_.size();
+
+        if (!validate()) return false;
+        cullPasses();
+        buildEdges();
+        schedule();
+        assignPhysical();
+        return true;
+    }
+
+    void execute() {
+        PassContext ctx;
+        ctx.textures = &textures_;
+
+        GLuint bound = 0xFFFFFFFFu; // 첫 pass는 항상 bind
+        GLuint prev  = 0xFFFFFFFFu; // 직전 pass의 target FBO (unbind와 무관)
+        stats_.fboBinds = 0;
+        stats_.targetChanges = 0;
+        for (int p : order_) {
+            const PassDesc& pass = passes_[p];
+            const Resource& t = resources_[pass.target];
+            const GLuint fbo = fboOf(pass.target);
+
+            if (fbo != prev) ++stats_.targetChanges;
+            prev = fbo;
+
+            if (!opt_.elideRebinds || fbo != bound) {
+                glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+                glViewport(0, 0, t.desc.w, t.desc.h);
+                ++stats_.fboBinds;
+                bound = fbo;
+            }
+            ctx.width  = t.desc.w;
+            ctx.height = t.desc.h;
+            pass.execute(ctx);
+
+            if (!opt_.elideRebinds) {
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                ++stats_.fboBinds;
+                bound = 0;
+            }
+        }
+    }
+
+    void release() {
+        for (RenderTarget& rt : physical_) destroyRenderTarget(rt);
+        physical_.clear();
+        physicalDesc_.clear();
+    }
+
+    const RenderGraphStats& stats() const { return stats_; }
+    const std::vector<int>& order() const { return order_; }
+    const PassDesc& pass(int i) const { return passes_[i]; }
+    const char* resourceName(ResourceId id) const { return resources_[id].name.c_str(); }
+
+    // transient resource가 배정된 physical texture 번호 (imported / 미사용이면 -1)
+    int physicalOf(ResourceId id) const { return resources_[id].physical; }
+    int firstUse(ResourceId id) const { return resources_[id].first; }
+    int lastUse(ResourceId id) const { return resources_[id].last; }
+    size_t resourceCount() const { return resources_.size(); }
+
+private:
+    struct Resource {
+        std::string  name;
+        TextureDesc  desc;
+        bool         imported = false;
+        bool         output   = false;
+        RenderTarget rt;            // imported인 경우
+        int          physical = -1; // transient인 경우 physical_ 인덱스
+        int          first    = -1; // order_ 상의 첫/마지막 사용 위치
+        int          last     = -1;
+    };
+
+    bool validate() const {
+        const int n = (int)resources_.size();
+        for (const PassDesc& p : passes_) {
+            if (p.target < 0 || p.target >= n) {
+                std::fprintf(stderr, "render graph: pass '%s' has no valid target\n", p.name.c_str());
+                return false;
+            }
+            for (ResourceId r : p.reads) {
+                if (r < 0 || r >= n) {
+                    std::fprintf(stderr, "render graph: pass '%s' reads an invalid resource\n", p.name.c_str());
+                    return false;
+                }
+                // 자기 target을 sampling하면 feedback loop (정의되지 않은 결과)
+                if (r == p.target) {
+                    std::fprintf(stderr, "render graph: pass '%s' samples its own target '%s'\n",
+                                 p.name.c_str(), resources_[r].name.c_str());
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // 역순으로 내려오며 "아직 필요한 resource"를 추적한다.
+    // target을 덮어쓰는(keepContents == false) pass 이전의 내용은 더 이상 필요하지 않다.
+    void cullPasses() {
+        alive_.assign(passes_.size(), 0);
+        std::vector<char> needed(resources_.size(), 0);
+        for (size_t r = 0; r < resources_.size(); ++r) needed[r] = resources_[r].output;
+
+        for (int p = (int)passes_.size() - 1; p >= 0; --p) {
+            const PassDesc& pass = passes_[p];
+            const bool live = !opt_.cull || pass.sideEffect || needed[pass.target];
+            if (!live) continue;
+
+            alive_[p] = 1;
+            if (!pass.keepContents) needed[pass.target] = 0;
+            for (ResourceId r : pass.reads) needed[r] = 1;
+            if (pass.keepContents) needed[pass.target] = 1;
+        }
+        for (char a : alive_) stats_.culledPasses += !a;
+    }
+
+    // 선언 순서 기준의 의존 edge: RAW(읽기 <- 마지막 쓰기), WAW(쓰기 <- 이전 쓰기), WAR(쓰기 <- 이전 읽기)
+    void buildEdges() {
+        const size_t np = passes_.size();
+        succ_.assign(np, {});
+        indegree_.assign(np, 0);
+
+        std::vector<int> lastWriter(resources_.size(), -1);
+        std::vector<std::vector<int>> readers(resources_.size());
+        auto addEdge = [&](int from, int to) {
+            for (int s : succ_[from]) if (s == to) return;
+            succ_[from].push_back(to);
+            ++indegree_[to];
+        };
+
+        for (int p = 0; p < (int)np; ++p) {
+            if (!alive_[p]) continue;
+            const PassDesc& pass = passes_[p];
+            for (ResourceId r : pass.reads) {
+                if (lastWriter[r] >= 0) addEdge(lastWriter[r], p);
+                readers[r].push_back(p);
+            }
+            const ResourceId t = pass.target;
+            if (lastWriter[t] >= 0) addEdge(lastWriter[t], p);
+            for (int q : readers[t]) addEdge(q, p);
+            readers[t].clear();
+            lastWriter[t] = p;
+        }
+    }
+
+    // Kahn 위상 정렬. 준비된 pass 중 (1) 직전 pass와 같은 target을 쓰는 pass, (2) 선언 순서가 빠른 pass를 고른다.
+    // reorder == false이면 선언 순서 그대로 실행한다 (선언 순서도 항상 올바른 위상 순서이다).
+    void schedule() {
+        order_.clear();
+        if (!opt_.reorder) {
+            for (int p = 0; p < (int)passes_.size(); ++p)
+                if (alive_[p]) order_.push_back(p);
+        } else {
+            std::vector<int> indeg = indegree_;
+            std::vector<int> ready;
+            for (int p = 0; p < (int)passes_.size(); ++p)
+                if (alive_[p] && indeg[p] == 0) ready.push_back(p);
+
+            ResourceId prevTarget = kNoResource;
+            while (!ready.empty()) {
+                size_t best = 0;
+                for (size_t i = 1; i < ready.size(); ++i) {
+                    const bool bi = passes_[ready[i]].target == prevTarget;
+                    const bool bb = passes_[ready[best]].target == prevTarget;
+                    if (bi != bb ? bi : ready[i] < ready[best]) best = i;
+                }
+                const int p = ready[best];
+                ready.erase(ready.begin() + (std::ptrdiff_t)best);
+                order_.push_back(p);
+                prevTarget = passes_[p].target;
+                for (int s : succ_[p])
+                    if (--indeg[s] == 0) ready.push_back(s);
+            }
+        }
+
+        for (Resource& r : resources_) { r.first = r.last = -1; r.physical = -1; }
+        for (int i = 0; i < (int)order_.size(); ++i) {
+            const PassDesc& pass = passes_[order_[i]];
+            auto touch = [&](ResourceId id) {
+                Resource& r = resources_[id];
+                if (r.first < 0) r.first = i;
+                r.last = i;
+            };
+            for (ResourceId r : pass.reads) touch(r);
+            touch(pass.target);
+        }
+    }
+
+    // 첫 사용 순서로 훑으며, 같은 desc이고 이미 수명이 끝난 physical texture가 있으면 재사용한다 (interval coloring)
+    void assignPhysical() {
+        std::vector<int> byFirst;
+        for (int r = 0; r < (int)resources_.size(); ++r)
+            if (!resources_[r].imported && resources_[r].first >= 0) byFirst.push_back(r);
+        std::sort(byFirst.begin(), byFirst.end(), [&](int a, int b) {
+            return resources_[a].first != resources_[b].first ? resources_[a].first < resources_[b].first : a < b;
+        });
+
+        std::vector<int> busyUntil; // physical별 마지막 사용 위치
+        for (int r : byFirst) {
+            Resource& res = resources_[r];
+            int slot = -1;
+            if (opt_.alias) {
+                for (int s = 0; s < (int)physicalDesc_.size(); ++s) {
+                    if (physicalDesc_[s] == res.desc && busyUntil[s] < res.first) { slot = s; break; }
+                }
+            }
+            if (slot < 0) {
+                slot = (int)physicalDesc_.size();
+                physicalDesc_.push_back(res.desc);
+                busyUntil.push_back(-1);
+                physical_.push_back(makeRenderTarget(res.desc.w, res.desc.h, res.desc.format));
+                stats_.physicalBytes += textureBytes(res.desc);
+            }
+            busyUntil[slot] = res.last;
+            res.physical = slot;
+            stats_.transientBytes += textureBytes(res.desc);
+            ++stats_.transientTextures;
+        }
+        stats_.physicalTextures = (int)physical_.size();
+
+        textures_.assign(resources_.size(), 0);
+        for (size_t r = 0; r < resources_.size(); ++r) {
+            const Resource& res = resources_[r];
+            if (res.imported)           textures_[r] = res.rt.color;
+            else if (res.physical >= 0) textures_[r] = physical_[res.physical].color;
+        }
+    }
+
+    GLuint fboOf(ResourceId id) const {
+        const Resource& r = resources_[id];
+        return r.imported ? r.rt.fbo : physical_[r.physical].fbo;
+    }
+
+    std::vector<Resource> resources_;
+    std::vector<PassDesc> passes_;
+    RenderGraphOptions    opt_;
+    RenderGraphStats      stats_;
+
+    std::vector<char>             alive_;
+    std::vector<std::vector<int>> succ_;
+    std::vector<int>              indegree_;
+    std::vector<int>              order_;
+
+    std::vector<RenderTarget> physical_;
+    std::vector<TextureDesc>  physicalDesc_;
+    std::vector<GLuint>       textures_;
+};
+
+} // namespace cg101
@@ -0,0 +1,305 @@
+// include/cg101/shared_context.hpp
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <cg101/egl_context.hpp>
+#include <cg101/timer.hpp>
+
+namespace cg101 {
+
+// main context와 object를 공유하는 두 번째 context (worker thread용).
+// buffer/texture/shader/program/sync object는 공유되고, VAO/FBO 같은 container object는 공유되지 않는다.
+// 그래서 worker가 만든 buffer로 그리려면 main thread가 자기 VAO를 만들어 연결해야 한다.
+struct SharedContext {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface surface = EGL_NO_SURFACE; // surfaceless이면 EGL_NO_SURFACE
+};
+
+// main과 같은 config로 share context를 만든다. 아무 thread에도 current로 만들지 않는다.
+// surfaceless = true이면 EGL_KHR_surfaceless_context로 surface 없이, 아니면 1x1 pbuffer를 붙인다.
+static inline bool createSharedContext(const HeadlessContext& main, SharedContext& out, bool surfaceless = false) {
+    EGLDisplay dpy = main.display;
+
+    EGLint cfgId = 0;
+    eglQueryContext(dpy, main.context, EGL_CONFIG_ID, &cfgId);
+    EGLConfig cfg = EGL_NO_CONFIG_KHR;
+    if (cfgId != 0) {
+        const EGLint idAttribs[] = { EGL_CONFIG_ID, cfgId, EGL_NONE };
+        EGLint numCfg = 0;
+        if (!eglChooseConfig(dpy, idAttribs, &cfg, 1, &numCfg) || numCfg == 0) cfg = EGL_NO_CONFIG_KHR;
+    }
+
+    if (surfaceless) {
+        const char* exts = eglQueryString(dpy, EGL_EXTENSIONS);
+        if (!exts || !std::strstr(exts, "EGL_KHR_surfaceless_context")) {
+            std::fprintf(stderr, "EGL_KHR_surfaceless_context is not supported!\n");
+            return false;
+        }
+    } else if (cfg == EGL_NO_CONFIG_KHR) {
+        std::fprintf(stderr, "pbuffer needs an EGLConfig, but the main context has none!\n");
+        return false;
+    }
+
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint ctxAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION,       3,
+        EGL_CONTEXT_MINOR_VERSION,       3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext ctx = eglCreateContext(dpy, cfg, main.context, ctxAttribs);
+    if (ctx == EGL_NO_CONTEXT) {
+        std::fprintf(stderr, "eglCreateContext(shared) failed! (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    EGLSurface surf = EGL_NO_SURFACE;
+    if (!surfaceless) {
+        const EGLint pbAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surf = eglCreatePbufferSurface(dpy, cfg, pbAttribs);
+        if (surf == EGL_NO_SURFACE) {
+            std::fprintf(stderr, "eglCreatePbufferSurface failed! (0x%x)\n", eglGetError());
+            eglDestroyContext(dpy, ctx);
+            return false;
+        }
+    }
+
+    out.display = dpy;
+    out.context = ctx;
+    out.surface = surf;
+    return true;
+}
+
+// 호출한 thread에 context를 붙인다. EGL의 bound API는 thread마다 따로이므로 여기서 다시 지정한다.
+// glad 함수 포인터는 process 전역이고 같은 driver를 가리키므로 다시 로딩하지 않는다.
+static inline bool makeCurrent(const SharedContext& sc) {
+    eglBindAPI(EGL_OPENGL_API);
+    if (!eglMakeCurrent(sc.display, sc.surface, sc.surface, sc.context)) {
+        std::fprintf(stderr, "eglMakeCurrent(shared) failed! (0x%x)\n", eglGetError());
+        return false;
+    }
+    return true;
+}
+
+// 어떤 thread에도 current가 아닐 때 호출한다
+static inline void destroySharedContext(SharedContext& sc) {
+    if (sc.display == EGL_NO_DISPLAY) return;
+    if (sc.surface != EGL_NO_SURFACE) eglDestroySurface(sc.display, sc.surface);
+    if (sc.context != EGL_NO_CONTEXT) eglDestroyContext(sc.display, sc.context);
+    sc = {};
+}
+
+// ------------------------------------------------------------
+// SharedGlWorker: share context를 가진 worker thread 하나
+// ------------------------------------------------------------
+// submit()한 job은 worker thread에서 share context가 current인 상태로 순서대로 실행된다.
+// job이 끝나면 worker가 glFenceSync + glFlush로 fence를 남기고, main thread는 그 fence로 hand-off한다.
+//   ready(t)   : block 없이 확인. fence가 GPU에서 signal 되었으면 true (glClientWaitSync, timeout 0)
+//   acquire(t) : worker의 CPU 작업이 끝날 때까지만 기다리고, GPU 쪽은 glWaitSync로 main 명령 stream에 순서를 건다
+// 둘 중 하나가 성공한 뒤에야 main context에서 그 object를 (다시) bind해 사용한다.
+// job이 쓰는 결과(GL 이름 등)는 ready()/acquire()가 성공한 뒤에 main thread에서 읽는다 (mutex가 순서를 보장).
+class SharedGlWorker {
+public:
+    using Ticket = uint32_t;
+
+    SharedGlWorker() = default;
+    SharedGlWorker(const SharedGlWorker&) = delete;
+    SharedGlWorker& operator=(const SharedGlWorker&) = delete;
+    ~SharedGlWorker() { stop(); }
+
+    // main context가 current인 thread에서 호출한다. stop() 뒤에 다시 start()할 수 있다.
+    // background = true이면 worker를 SCHED_IDLE로 낮춰 main thread가 쉬는 동안에만 CPU를 쓰게 한다.
+    // core 수가 적으면 같은 우선순위의 worker가 main의 frame 도중에 CPU를 나눠 가져가 frame이 늘어난다.
+    // 낮추지 못하면 stderr에 알리고 보통 우선순위로 계속한다 (runsInBackground()로 확인).
+    bool start(const HeadlessContext& main, bool surfaceless = false, bool background = true) {
+        if (thread_.joinable()) return false;
+        if (!createSharedContext(main, ctx_, surfaceless)) return false;
+        busyMs_        = 0.0;
+        acquireWaitMs_ = 0.0;
+        background_    = false;
+
+        bool ok = false, started = false;
+        thread_ = std::thread([this, &ok, &started, background]() {
+            bool idle = false;
+#if defined(__linux__)
+            if (background) {
+                sched_param sp{};
+                const int err = pthread_setschedparam(pthread_self(), SCHED_IDLE, &sp);
+                if (err != 0)
+                    std::fprintf(stderr, "SharedGlWorker: SCHED_IDLE failed (%s), worker runs at normal priority\n",
+                                 std::strerror(err));
+                idle = err == 0;
+            }
+#else
+            (void)background;
+#endif
+            const bool current = makeCurrent(ctx_);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ok = current;
+                background_ = idle;
+                started = true;
+            }
+            cv_.notify_all();
+            if (current) loop();
+        });
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&]() { return started; });
+        lock.unlock();
+        if (!ok) {
+            thread_.join();
+            destroySharedContext(ctx_);
+        }
+        return ok;
+    }
+
+    // 남은 job을 모두 실행한 뒤 thread를 끝낸다. main context가 current인 thread에서 호출한다.
+    void stop() {
+        if (!thread_.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        cv_.notify_all();
+        thread_.join();
+        destroySharedContext(ctx_);
+
+        for (Slot& s : slots_)
+            if (s.fence) glDeleteSync(s.fence);
+        slots_.clear();
+        quit_ = false; // 다음 start()의 loop가 바로 끝나지 않도록
+    }
+
+    Ticket submit(std::function<void()> job) {
+        Ticket t;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            t = (Ticket)slots_.size();
+            slots_.push_back({});
+            queue_.push_back({ t, std::move(job) });
+        }
+        cv_.notify_all();
+        return t;
+    }
+
+    bool ready(Ticket t) {
+        GLsync fence = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (slots_[t].state == State::Done) return true;
+            if (slots_[t].state != State::Fenced) return false;
+            fence = slots_[t].fence;
+        }
+        const GLenum r = glClientWaitSync(fence, 0, 0);
+        if (r != GL_ALREADY_SIGNALED && r != GL_CONDITION_SATISFIED) return false;
+        retire(t);
+        return true;
+    }
+
+    void acquire(Ticket t) {
+        Stopwatch sw;
+        GLsync fence = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&]() { return slots_[t].state != State::Queued; });
+            if (slots_[t].state == State::Done) return;
+            fence = slots_[t].fence;
+        }
+        glWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+        retire(t);
+        acquireWaitMs_ += sw.elapsed_ms();
+    }
+
+    // worker thread가 job 실행에 쓴 시간 (main thread가 대신 썼다면 그대로 stall이 되었을 시간)
+    double workerBusyMs() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return busyMs_;
+    }
+    // acquire()에서 main thread가 기다린 시간
+    double acquireWaitMs() const { return acquireWaitMs_; }
+    // worker가 실제로 SCHED_IDLE로 돌고 있는지
+    bool runsInBackground() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return background_;
+    }
+
+private:
+    enum class State : uint8_t { Queued, Fenced, Done };
+
+    struct Slot {
+        State  state = State::Queued;
+        GLsync fence = nullptr;
+    };
+
+    struct Job {
+        Ticket                ticket;
+        std::function<void()> fn;
+    };
+
+    void loop() {
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&]() { return quit_ || !queue_.empty(); });
+                if (queue_.empty()) break; // quit_ && 남은 job 없음
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            Stopwatch sw;
+            job.fn();
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush(); // flush하지 않으면 다른 context가 기다리는 fence가 영영 GPU에 도달하지 않을 수 있다
+            const double ms = sw.elapsed_ms();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                slots_[job.ticket].state = State::Fenced;
+                slots_[job.ticket].fence = fence;
+                busyMs_ += ms;
+            }
+            cv_.notify_all();
+        }
+        eglMakeCurrent(ctx_.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    void retire(Ticket t) {
+        GLsync fence;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fence = slots_[t].fence;
+            slots_[t].fence = nullptr;
+            slots_[t].state = State::Done;
+        }
+        glDeleteSync(fence);
+    }
+
+    SharedContext           ctx_;
+    std::thread             thread_;
+    mutable std::mutex      mutex_;
+    std::condition_variable cv_;
+    std::deque<Job>         queue_;
+    std::vector<Slot>       slots_;
+    bool                    quit_          = false;
+    bool                    background_    = false;
+    double                  busyMs_        = 0.0;
+    double                  acquireWaitMs_ = 0.0;
+};
+
+} // namespace cg101
@@ -0,0 +1,505 @@
+// include/cg101/spatial_index.hpp
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <cg101/parallel.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// 2D 기본 도형
+// ------------------------------------------------------------
+
+struct Aabb2 {
+    float minX, minY, maxX, maxY;
+};
+
+static inline bool overlaps(const Aabb2& a, const Aabb2& b) {
+    return a.minX <= b.maxX && b.minX <= a.maxX &&
+           a.minY <= b.maxY && b.minY <= a.maxY;
+}
+
+static inline bool contains(const Aabb2& a, float x, float y) {
+    return x >= a.minX && x <= a.maxX && y >= a.minY && y <= a.maxY;
+}
+
+static inline Aabb2 merge(const Aabb2& a, const Aabb2& b) {
+    return { std::min(a.minX, b.minX), std::min(a.minY, b.minY),
+             std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY) };
+}
+
+// 점과 box 사이의 최소 거리^2 (점이 box 안이면 0)
+static inline float distSq(const Aabb2& a, float x, float y) {
+    const float dx = std::max(std::max(a.minX - x, 0.0f), x - a.maxX);
+    const float dy = std::max(std::max(a.minY - y, 0.0f), y - a.maxY);
+    return dx * dx + dy * dy;
+}
+
+// kNN에서 객체의 위치는 AABB 중심으로 정의한다
+static inline float centerDistSq(const Aabb2& a, float x, float y) {
+    const float dx = (a.minX + a.maxX) * 0.5f - x;
+    const float dy = (a.minY + a.maxY) * 0.5f - y;
+    return dx * dx + dy * dy;
+}
+
+struct Triangle2 {
+    float x0, y0, x1, y1, x2, y2;
+};
+
+static inline Aabb2 bounds(const Triangle2& t) {
+    return { std::min({ t.x0, t.x1, t.x2 }), std::min({ t.y0, t.y1, t.y2 }),
+             std::max({ t.x0, t.x1, t.x2 }), std::max({ t.y0, t.y1, t.y2 }) };
+}
+
+// CH2-3의 2D "외적 유사량": (b-a) x (p-a)의 z 성분 = signed area * 2
+static inline float edge_function(float ax, float ay, float bx, float by, float px, float py) {
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+// winding(CCW/CW)에 무관하게, 세 edge function의 부호가 모두 같으면 내부 (경계 포함)
+static inline bool point_in_triangle(const Triangle2& t, float px, float py) {
+    const float e0 = edge_function(t.x0, t.y0, t.x1, t.y1, px, py);
+    const float e1 = edge_function(t.x1, t.y1, t.x2, t.y2, px, py);
+    const float e2 = edge_function(t.x2, t.y2, t.x0, t.y0, px, py);
+    return (e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f) ||
+           (e0 <= 0.0f && e1 <= 0.0f && e2 <= 0.0f);
+}
+
+// kNN 결과 수집용 max-heap (가장 먼 후보가 top)
+struct KnnHeap {
+    using Item = std::pair<float, uint32_t>; // (distSq, id)
+    std::priority_queue<Item> heap;
+    size_t k = 0;
+
+    explicit KnnHeap(size_t k_) : k(k_) {}
+
+    // k == 0이면 어떤 후보도 받지 않으므로 -INFINITY (탐색이 바로 끝난다)
+    float worst() const {
+        if (k == 0) return -INFINITY;
+        return heap.size() < k ? INFINITY : heap.top().first;
+    }
+
+    void push(float d, uint32_t id) {
+        if (k == 0) return;
+        if (heap.size() < k) heap.push({ d, id });
+        else if (d < heap.top().first) { heap.pop(); heap.push({ d, id }); }
+    }
+
+    // 가까운 순서로 out에 기록
+    void drain(std::vector<uint32_t>& out) {
+        out.resize(heap.size());
+        for (size_t i = heap.size(); i-- > 0;) { out[i] = heap.top().second; heap.pop(); }
+    }
+};
+
+// ------------------------------------------------------------
+// UniformGrid: loose uniform grid + 여유 slot이 있는 CSR cell storage
+// ------------------------------------------------------------
+//
+// 객체는 AABB 중심이 속한 cell 하나에만 들어간다 (loose). 대신 query는 모든 객체의
+// 최대 half extent만큼 범위를 넓혀 cell을 찾는다. 덕분에 객체당 entry가 정확히 1개이다.
+//
+// entries_는 cell 번호(row-major) 순서의 구간으로 나뉘고, cell c는 slot [cellStart_[c], cellStart_[c+1])을 가진다.
+// 그중 앞의 cellCount_[c]개만 유효하고 나머지는 다음 update에서 들어올 객체를 위한 여유 slot이다.
+// 한 row의 cell들은 entries_에서 인접하므로 range query는 row마다 짧은 구간 몇 개를 차례로 scan한다.
+//
+// update()는 모든 entry의 box/cell을 새로 계산하고(O(n), 병렬), cell이 바뀐 객체만 옮긴다:
+// 옛 cell에서는 마지막 유효 entry와 자리를 바꿔 빼고, 새 cell의 여유 slot에 넣는다.
+// 새 cell에 자리가 없으면 그 주변 cell 구간(window)을 여유 slot이 cell 수 이상이 될 때까지 두 배씩 넓혀
+// 그 안에서만 다시 배치한다. 객체가 한쪽으로 크게 몰려 window가 grid 전체가 될 때만 전체 재배치가 된다 (fallback).
+// 그래서 구조를 고치는 비용은 cell을 옮긴 객체 수(와 그 주변 window 크기)에 비례한다.
+class UniformGrid {
+public:
+    void build(const std::vector<Aabb2>& boxes, const Aabb2& world, float cellSize) {
+        originX_  = world.minX;
+        originY_  = world.minY;
+        cellSize_ = cellSize;
+        invCell_  = 1.0f / cellSize;
+        nx_ = std::max(1, (int)std::ceil((world.maxX - world.minX) * invCell_));
+        ny_ = std::max(1, (int)std::ceil((world.maxY - world.minY) * invCell_));
+
+        std::vector<Entry> packed(boxes.size());
+        parallelFor(0, boxes.size(), [&](size_t b, size_t e, unsigned) {
+            for (size_t i = b; i < e; ++i) {
+                packed[i].id   = (uint32_t)i;
+                packed[i].box  = boxes[i];
+                packed[i].cell = cellOf(boxes[i]);
+            }
+        });
+        computeMaxHalfExtent(boxes);
+        layoutWithSlack(packed);
+        lastMoved_ = lastRelocated_ = 0;
+        lastFallback_ = false;
+    }
+
+    // 이전 build/update와 같은 객체 집합(id)의 새 AABB로 갱신한다
+    void update(const std::vector<Aabb2>& boxes) {
+        computeMaxHalfExtent(boxes);
+        lastMoved_ = lastRelocated_ = 0;
+        lastFallback_ = false;
+
+        // 1) cell마다 유효 entry를 갱신하고, cell이 바뀐 entry는 빼서 chunk별 목록에 모은다
+        const size_t cells = cellCount();
+        std::vector<std::vector<Entry>> movedPerChunk(parallelChunkCount(cells));
+        parallelFor(0, cells, [&](size_t b, size_t e, unsigned chunk) {
+            std::vector<Entry>& moved = movedPerChunk[chunk];
+            for (size_t c = b; c < e; ++c) {
+                const uint32_t start = cellStart_[c];
+                uint32_t count = cellCount_[c];
+                for (uint32_t i = start; i < start + count;) {
+                    Entry& en = entries_[i];
+                    en.box  = boxes[en.id];
+                    en.cell = cellOf(en.box);
+                    if (en.cell == (uint32_t)c) { ++i; continue; }
+                    moved.push_back(en);
+                    en = entries_[start + count - 1]; // 마지막 유효 entry로 빈자리를 채운다 (i는 그대로 다시 검사)
+                    --count;
+                }
+                cellCount_[c] = count;
+            }
+        });
+
+        // 2) 옮길 entry를 새 cell에 넣는다
+        for (const std::vector<Entry>& moved : movedPerChunk) {
+            for (const Entry& en : moved) insert(en);
+            lastMoved_ += moved.size();
+        }
+    }
+
+    // 점을 AABB가 포함하는 객체
+    void queryPoint(float x, float y, std::vector<uint32_t>& out) const {
+        out.clear();
+        forEachCandidateRow({ x, y, x, y }, [&](const Entry& en) {
+            if (contains(en.box, x, y)) out.push_back(en.id);
+        });
+    }
+
+    // AABB가 r과 겹치는 객체
+    void queryRange(const Aabb2& r, std::vector<uint32_t>& out) const {
+        out.clear();
+        forEachCandidateRow(r, [&](const Entry& en) {
+            if (overlaps(en.box, r)) out.push_back(en.id);
+        });
+    }
+
+    // AABB 중심 기준 k-nearest, 가까운 순서로 out에 기록.
+    // query cell에서 시작해 Chebyshev ring을 넓혀 가며, 다음 ring의 최소 거리가 현재 k번째 거리보다 크면 멈춘다.
+    // (world 밖의 점/query는 cell 인덱스가 clamp되지만, world box로의 사영은 거리를 늘리지 않으므로 하한은 유효하다)
+    void knn(float x, float y, size_t k, std::vector<uint32_t>& out) const {
+        out.clear();
+        if (k == 0 || size_ == 0) return;
+
+        KnnHeap heap(k);
+        const int cx = clampi((int)std::floor((x - originX_) * invCell_), 0, nx_ - 1);
+        const int cy = clampi((int)std::floor((y - originY_) * invCell_), 0, ny_ - 1);
+        const int maxRing = std::max(nx_, ny_);
+
+        for (int r = 0; r <= maxRing; ++r) {
+            const int y0 = cy - r, y1 = cy + r;
+            for (int yy = std::max(y0, 0); yy <= std::min(y1, ny_ - 1); ++yy) {
+                if (yy == y0 || yy == y1) {
+                    // ring의 위/아래 변: 연속 구간 하나
+                    scanCells(yy, std::max(cx - r, 0), std::min(cx + r, nx_ - 1), x, y, heap);
+                } else {
+                    // ring의 좌/우 변: cell 하나씩
+                    if (cx - r >= 0)             scanCells(yy, cx - r, cx - r, x, y, heap);
+                    if (r > 0 && cx + r < nx_)   scanCells(yy, cx + r, cx + r, x, y, heap);
+                }
+            }
+            const float bound = (float)r * cellSize_;
+            if (heap.heap.size() == k && bound * bound > heap.worst()) break;
+        }
+        heap.drain(out);
+    }
+
+    size_t size() const { return size_; }
+    size_t cellCount() const { return (size_t)nx_ * ny_; }
+    size_t slotCount() const { return entries_.size(); }           // 여유 slot 포함
+    size_t lastUpdateMoved() const { return lastMoved_; }           // 마지막 update에서 cell이 바뀐 객체 수
+    size_t lastUpdateRelocated() const { return lastRelocated_; }   // window 재배치로 다시 쓴 entry 수
+    bool   lastUpdateFellBack() const { return lastFallback_; }     // 마지막 update에서 window가 grid 전체로 커졌는가
+
+private:
+    struct Entry {
+        uint32_t cell;
+        uint32_t id;
+        Aabb2    box; // query 시 원본 배열을 다시 읽지 않도록 entry에 복사 (cache locality)
+    };
+
+    static int clampi(int v, int lo, int hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+    // cell 하나의 여유 slot 수 (객체 밀도가 높은 cell일수록 더 많이 받는다)
+    static uint32_t slackFor(uint32_t count) { return 1 + count / 4; }
+
+    uint32_t cellOf(const Aabb2& b) const {
+        const float cx = (b.minX + b.maxX) * 0.5f;
+        const float cy = (b.minY + b.maxY) * 0.5f;
+        const int ix = clampi((int)std::floor((cx - originX_) * invCell_), 0, nx_ - 1);
+        const int iy = clampi((int)std::floor((cy - originY_) * invCell_), 0, ny_ - 1);
+        return (uint32_t)(iy * nx_ + ix);
+    }
+
+    void computeMaxHalfExtent(const std::vector<Aabb2>& boxes) {
+        float hw = 0.0f, hh = 0.0f;
+        for (const Aabb2& b : boxes) {
+            hw = std::max(hw, (b.maxX - b.minX) * 0.5f);
+            hh = std::max(hh, (b.maxY - b.minY) * 0.5f);
+        }
+        maxHalfW_ = hw;
+        maxHalfH_ = hh;
+    }
+
+    // packed(cell 순서 무관)를 counting sort로 cell 구간에 나누고, cell마다 slackFor(count)개의 여유 slot을 둔다
+    void layoutWithSlack(const std::vector<Entry>& packed) {
+        const size_t cells = cellCount();
+        size_ = packed.size();
+        cellCount_.assign(cells, 0);
+        for (const Entry& en : packed) ++cellCount_[en.cell];
+
+        cellStart_.assign(cells + 1, 0);
+        for (size_t c = 0; c < cells; ++c) cellStart_[c + 1] = cellStart_[c] + cellCount_[c] + slackFor(cellCount_[c]);
+
+        entries_.assign(cellStart_[cells], Entry{});
+        std::vector<uint32_t> cursor(cellStart_.begin(), cellStart_.end() - 1);
+        for (const Entry& en : packed) entries_[cursor[en.cell]++] = en; // stable
+    }
+
+    uint32_t freeSlots(size_t c) const { return cellStart_[c + 1] - cellStart_[c] - cellCount_[c]; }
+
+    // en.cell에 넣는다. 자리가 없으면 주변 window를 넓혀 가며 그 안에서 재배치한다.
+    // 전체 여유 slot 수는 build 때의 cellCount() 이상으로 유지되므로 window가 grid 전체가 되면 항상 들어간다.
+    void insert(const Entry& en) {
+        const size_t c = en.cell;
+        if (freeSlots(c) > 0) {
+            entries_[cellStart_[c] + cellCount_[c]++] = en;
+            return;
+        }
+
+        // window [lo, hi)의 여유 slot이 cell 수 이상(= 재배치 뒤 cell마다 평균 1개)이 될 때까지 넓힌다
+        const size_t cells = cellCount();
+        size_t lo = c, hi = c + 1, width = 1;
+        size_t free = 0;
+        while (free < hi - lo) {
+            if (lo == 0 && hi == cells) break;
+            width *= 2;
+            const size_t nlo = c >= width ? c - width : 0;
+            const size_t nhi = std::min(cells, c + width + 1);
+            for (size_t i = nlo; i < lo; ++i) free += freeSlots(i);
+            for (size_t i = hi; i < nhi; ++i) free += freeSlots(i);
+            lo = nlo;
+            hi = nhi;
+        }
+        if (lo == 0 && hi == cells) lastFallback_ = true; // 사실상 전체 재배치
+
+        // window 안의 유효 entry를 cell 순서로 모아 새 entry를 더하고, 여유 slot을 cell마다 고르게 다시 나눈다
+        std::vector<Entry> tmp;
+        for (size_t i = lo; i < hi; ++i) {
+            tmp.insert(tmp.end(), entries_.begin() + cellStart_[i], entries_.begin() + cellStart_[i] + cellCount_[i]);
+            if (i == c) tmp.push_back(en);
+        }
+        ++cellCount_[c];
+
+        const size_t n = hi - lo;
+        const uint32_t spare = (uint32_t)(free - 1);
+        uint32_t pos = cellStart_[lo];
+        size_t src = 0;
+        for (size_t i = lo; i < hi; ++i) {
+            cellStart_[i] = pos;
+            for (uint32_t j = 0; j < cellCount_[i]; ++j) entries_[pos + j] = tmp[src++];
+            const uint32_t share = spare / (uint32_t)n + ((i - lo) < spare % n ? 1u : 0u);
+            pos += cellCount_[i] + share;
+        }
+        lastRelocated_ += tmp.size();
+    }
+
+    // r을 최대 half extent만큼 넓힌 cell 사각형의 각 row를 scan
+    template <class Fn>
+    void forEachCandidateRow(const Aabb2& r, Fn&& fn) const {
+        const int x0 = clampi((int)std::floor((r.minX - maxHalfW_ - originX_) * invCell_), 0, nx_ - 1);
+        const int x1 = clampi((int)std::floor((r.maxX + maxHalfW_ - originX_) * invCell_), 0, nx_ - 1);
+        const int y0 = clampi((int)std::floor((r.minY - maxHalfH_ - originY_) * invCell_), 0, ny_ - 1);
+        const int y1 = clampi((int)std::floor((r.maxY + maxHalfH_ - originY_) * invCell_), 0, ny_ - 1);
+
+        for (int yy = y0; yy <= y1; ++yy) {
+            for (size_t c = (size_t)yy * nx_ + x0; c <= (size_t)yy * nx_ + x1; ++c) {
+                const uint32_t b = cellStart_[c];
+                const uint32_t e = b + cellCount_[c];
+                for (uint32_t i = b; i < e; ++i) fn(entries_[i]);
+            }
+        }
+    }
+
+    void scanCells(int row, int x0, int x1, float x, float y, KnnHeap& heap) const {
+        for (size_t c = (size_t)row * nx_ + x0; c <= (size_t)row * nx_ + x1; ++c) {
+            const uint32_t b = cellStart_[c];
+            const uint32_t e = b + cellCount_[c];
+            for (uint32_t i = b; i < e; ++i)
+                heap.push(centerDistSq(entries_[i].box, x, y), entries_[i].id);
+        }
+    }
+
+    float originX_ = 0.0f, originY_ = 0.0f;
+    float cellSize_ = 1.0f, invCell_ = 1.0f;
+    int   nx_ = 1, ny_ = 1;
+    float maxHalfW_ = 0.0f, maxHalfH_ = 0.0f;
+    size_t size_          = 0;
+    size_t lastMoved_     = 0;
+    size_t lastRelocated_ = 0;
+    bool   lastFallback_  = false;
+
+    std::vector<Entry>    entries_;   // 여유 slot 포함
+    std::vector<uint32_t> cellStart_; // size = cellCount() + 1 (slot 구간 경계)
+    std::vector<uint32_t> cellCount_; // size = cellCount() (cell별 유효 entry 수)
+};
+
+// ------------------------------------------------------------
+// Bvh2: 정적 scene용 bounding volume hierarchy
+// ------------------------------------------------------------
+//
+// 중심 좌표의 가장 긴 축을 median으로 나누는 top-down build. node는 depth-first 순서의
+// 배열 하나에 저장되어 left child는 항상 바로 다음 node이고, right child만 인덱스를 가진다.
+// leaf의 객체 box도 leaf 순서로 재배치해 traversal 중 연속 메모리만 읽는다.
+class Bvh2 {
+public:
+    void build(const std::vector<Aabb2>& boxes, uint32_t leafSize = 4) {
+        const uint32_t n = (uint32_t)boxes.size();
+        nodes_.clear();
+        ids_.resize(n);
+        for (uint32_t i = 0; i < n; ++i) ids_[i] = i;
+        if (n == 0) { boxes_.clear(); return; }
+        nodes_.reserve(2 * (n / std::max(leafSize, 1u)) + 1);
+
+        std::vector<float> cx(n), cy(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            cx[i] = (boxes[i].minX + boxes[i].maxX) * 0.5f;
+            cy[i] = (boxes[i].minY + boxes[i].maxY) * 0.5f;
+        }
+
+        // node는 stack에서 꺼낼 때 할당한다. left task를 right보다 나중에 push하므로 항상 부모 바로 다음에
+        // 꺼내져 left = parent + 1이 되고, right는 left subtree가 모두 끝난 뒤 꺼내질 때 인덱스가 정해진다.
+        struct Task { uint32_t parent, start, count; bool isRight; };
+        std::vector<Task> stack;
+        stack.push_back({ 0, 0, n, false });
+
+        while (!stack.empty()) {
+            const Task t = stack.back();
+            stack.pop_back();
+
+            const uint32_t idx = (uint32_t)nodes_.size();
+            nodes_.push_back({});
+            if (t.isRight) nodes_[t.parent].right = idx;
+
+            Aabb2 box = boxes[ids_[t.start]];
+            Aabb2 cbox = { cx[ids_[t.start]], cy[ids_[t.start]], cx[ids_[t.start]], cy[ids_[t.start]] };
+            for (uint32_t i = t.start + 1; i < t.start + t.count; ++i) {
+                const uint32_t id = ids_[i];
+                box  = merge(box, boxes[id]);
+                cbox = merge(cbox, { cx[id], cy[id], cx[id], cy[id] });
+            }
+            nodes_[idx].box = box;
+
+            if (t.count <= leafSize) {
+                nodes_[idx].start = t.start;
+                nodes_[idx].count = t.count;
+                continue;
+            }
+
+            const bool splitX = (cbox.maxX - cbox.minX) >= (cbox.maxY - cbox.minY);
+            const uint32_t mid = t.start + t.count / 2;
+            auto first = ids_.begin() + t.start;
+            if (splitX)
+                std::nth_element(first, ids_.begin() + mid, first + t.count,
+                                 [&](uint32_t a, uint32_t b) { return cx[a] < cx[b]; });
+            else
+                std::nth_element(first, ids_.begin() + mid, first + t.count,
+                                 [&](uint32_t a, uint32_t b) { return cy[a] < cy[b]; });
+
+            stack.push_back({ idx, mid, t.start + t.count - mid, true });
+            stack.push_back({ idx, t.start, mid - t.start, false });
+        }
+
+        boxes_.resize(n);
+        for (uint32_t i = 0; i < n; ++i) boxes_[i] = boxes[ids_[i]];
+    }
+
+    void queryPoint(float x, float y, std::vector<uint32_t>& out) const {
+        out.clear();
+        traverse([&](const Aabb2& b) { return contains(b, x, y); }, out);
+    }
+
+    void queryRange(const Aabb2& r, std::vector<uint32_t>& out) const {
+        out.clear();
+        traverse([&](const Aabb2& b) { return overlaps(b, r); }, out);
+    }
+
+    // best-first: node box까지의 거리를 하한으로 쓰는 priority queue traversal
+    void knn(float x, float y, size_t k, std::vector<uint32_t>& out) const {
+        out.clear();
+        if (k == 0 || nodes_.empty()) return;
+
+        KnnHeap heap(k);
+
+        using QItem = std::pair<float, uint32_t>; // (lower bound distSq, node)
+        std::priority_queue<QItem, std::vector<QItem>, std::greater<QItem>> open;
+        open.push({ distSq(nodes_[0].box, x, y), 0u });
+
+        while (!open.empty()) {
+            const QItem q = open.top();
+            open.pop();
+            if (q.first > heap.worst()) break;
+
+            const Node& nd = nodes_[q.second];
+            if (nd.count > 0) {
+                for (uint32_t i = nd.start; i < nd.start + nd.count; ++i)
+                    heap.push(centerDistSq(boxes_[i], x, y), ids_[i]);
+            } else {
+                const uint32_t l = q.second + 1, r = nd.right;
+                open.push({ distSq(nodes_[l].box, x, y), l });
+                open.push({ distSq(nodes_[r].box, x, y), r });
+            }
+        }
+        heap.drain(out);
+    }
+
+    size_t nodeCount() const { return nodes_.size(); }
+
+private:
+    struct Node {
+        Aabb2    box   = { 0.0f, 0.0f, 0.0f, 0.0f };
+        uint32_t start = 0; // leaf: boxes_/ids_ 구간 시작
+        uint32_t count = 0; // > 0 이면 leaf
+        uint32_t right = 0; // interior: right child (left child = 자기 인덱스 + 1)
+    };
+
+    template <class Pred>
+    void traverse(Pred&& pred, std::vector<uint32_t>& out) const {
+        if (nodes_.empty()) return;
+        uint32_t stack[64];
+        int sp = 0;
+        stack[sp++] = 0;
+        while (sp > 0) {
+            const Node& nd = nodes_[stack[--sp]];
+            if (!pred(nd.box)) continue;
+            if (nd.count > 0) {
+                for (uint32_t i = nd.start; i < nd.start + nd.count; ++i)
+                    if (pred(boxes_[i])) out.push_back(ids_[i]);
+            } else {
+                const uint32_t self = (uint32_t)(&nd - nodes_.data());
+                stack[sp++] = nd.right;
+                stack[sp++] = self + 1;
+            }
+        }
+    }
+
+    std::vector<Node>     nodes_;
+    std::vector<uint32_t> ids_;   // leaf 순서의 객체 id
+    std::vector<Aabb2>    boxes_; // leaf 순서의 객체 box
+};
+
+} // namespace cg101
@@ -0,0 +1,19 @@
+// include/cg101/timer.hpp
+#pragma once
+#include <chrono>
+
+namespace cg101 {
+
+// wall-clock 측정용. GPU 작업은 glFinish() 이후에 elapsed를 읽어야 의미가 있다.
+struct Stopwatch {
+    using clock = std::chrono::steady_clock;
+    clock::time_point start = clock::now();
+
+    void reset() { start = clock::now(); }
+
+    double elapsed_ms() const {
+        return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    }
+};
+
+} // namespace cg101
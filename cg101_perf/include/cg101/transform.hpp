@@ -0,0 +1,394 @@
+// include/cg101/transform.hpp
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <cg101/vec.hpp>
+
+namespace cg101 {
+
+// ------------------------------------------------------------
+// Mat4: column-major 4x4 (GLSL/glm과 같은 메모리 배치, glUniformMatrix4fv(..., GL_FALSE, m)에 그대로 전달)
+// ------------------------------------------------------------
+//
+// m[c*4 + r] = c번째 column, r번째 row. CH3-4의 표기로
+//   [ A  t ]     A: 3x3 선형 부분 (column 0..2의 xyz)
+//   [ 0  1 ]     t: translation (column 3의 xyz)
+struct alignas(32) Mat4 {
+    float m[16];
+};
+
+static inline Mat4 mat4_identity() {
+    return { { 1.0f, 0.0f, 0.0f, 0.0f,
+               0.0f, 1.0f, 0.0f, 0.0f,
+               0.0f, 0.0f, 1.0f, 0.0f,
+               0.0f, 0.0f, 0.0f, 1.0f } };
+}
+
+// 기준 구현: r[c][r] = sum_k a[k][r] * b[c][k]
+static inline Mat4 mul_scalar(const Mat4& a, const Mat4& b) {
+    Mat4 r;
+    for (int c = 0; c < 4; ++c) {
+        for (int row = 0; row < 4; ++row) {
+            float s = 0.0f;
+            for (int k = 0; k < 4; ++k) s += a.m[k * 4 + row] * b.m[c * 4 + k];
+            r.m[c * 4 + row] = s;
+        }
+    }
+    return r;
+}
+
+#if defined(__SSE2__)
+static inline __m128 madd128(__m128 a, __m128 b, __m128 c) {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+#endif
+
+#if defined(__AVX__)
+static inline __m256 madd256(__m256 a, __m256 b, __m256 c) {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#endif
+
+// column-major 곱: 결과의 column c = a.col0 * b[c][0] + a.col1 * b[c][1] + a.col2 * b[c][2] + a.col3 * b[c][3]
+// AVX는 결과 column 두 개를 256-bit register 하나로 동시에 만든다.
+static inline Mat4 mul(const Mat4& a, const Mat4& b) {
+#if defined(__AVX__)
+    Mat4 r;
+    const __m256 a0 = _mm256_broadcast_ps((const __m128*)&a.m[0]);
+    const __m256 a1 = _mm256_broadcast_ps((const __m128*)&a.m[4]);
+    const __m256 a2 = _mm256_broadcast_ps((const __m128*)&a.m[8]);
+    const __m256 a3 = _mm256_broadcast_ps((const __m128*)&a.m[12]);
+    for (int c = 0; c < 4; c += 2) {
+        const __m256 bc = _mm256_load_ps(&b.m[c * 4]); // column c, c+1
+        __m256 v = _mm256_mul_ps(a0, _mm256_permute_ps(bc, 0x00));
+        v = madd256(a1, _mm256_permute_ps(bc, 0x55), v);
+        v = madd256(a2, _mm256_permute_ps(bc, 0xAA), v);
+        v = madd256(a3, _mm256_permute_ps(bc, 0xFF), v);
+        _mm256_store_ps(&r.m[c * 4], v);
+    }
+    return r;
+#elif defined(__SSE2__)
+    Mat4 r;
+    const __m128 a0 = _mm_load_ps(&a.m[0]);
+    const __m128 a1 = _mm_load_ps(&a.m[4]);
+    const __m128 a2 = _mm_load_ps(&a.m[8]);
+    const __m128 a3 = _mm_load_ps(&a.m[12]);
+    for (int c = 0; c < 4; ++c) {
+        const float* bc = &b.m[c * 4];
+        __m128 v = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+        v = madd128(a1, _mm_set1_ps(bc[1]), v);
+        v = madd128(a2, _mm_set1_ps(bc[2]), v);
+        v = madd128(a3, _mm_set1_ps(bc[3]), v);
+        _mm_store_ps(&r.m[c * 4], v);
+    }
+    return r;
+#else
+    return mul_scalar(a, b);
+#endif
+}
+
+// 일반 4x4 역행렬 (cofactor 전개). 특이 행렬이면 false
+static inline bool inverse_general(const Mat4& mat, Mat4& out) {
+    const float* m = mat.m;
+    float inv[16];
+
+    inv[0]  =  m[5]*m[10]*m[15] - m[5]*m[11]*m[14] - m[9]*m[6]*m[15] + m[9]*m[7]*m[14] + m[13]*m[6]*m[11] - m[13]*m[7]*m[10];
+    inv[4]  = -m[4]*m[10]*m[15] + m[4]*m[11]*m[14] + m[8]*m[6]*m[15] - m[8]*m[7]*m[14] - m[12]*m[6]*m[11] + m[12]*m[7]*m[10];
+    inv[8]  =  m[4]*m[9]*m[15]  - m[4]*m[11]*m[13] - m[8]*m[5]*m[15] + m[8]*m[7]*m[13] + m[12]*m[5]*m[11] - m[12]*m[7]*m[9];
+    inv[12] = -m[4]*m[9]*m[14]  + m[4]*m[10]*m[13] + m[8]*m[5]*m[14] - m[8]*m[6]*m[13] - m[12]*m[5]*m[10] + m[12]*m[6]*m[9];
+    inv[1]  = -m[1]*m[10]*m[15] + m[1]*m[11]*m[14] + m[9]*m[2]*m[15] - m[9]*m[3]*m[14] - m[13]*m[2]*m[11] + m[13]*m[3]*m[10];
+    inv[5]  =  m[0]*m[10]*m[15] - m[0]*m[11]*m[14] - m[8]*m[2]*m[15] + m[8]*m[3]*m[14] + m[12]*m[2]*m[11] - m[12]*m[3]*m[10];
+    inv[9]  = -m[0]*m[9]*m[15]  + m[0]*m[11]*m[13] + m[8]*m[1]*m[15] - m[8]*m[3]*m[13] - m[12]*m[1]*m[11] + m[12]*m[3]*m[9];
+    inv[13] =  m[0]*m[9]*m[14]  - m[0]*m[10]*m[13] - m[8]*m[1]*m[14] + m[8]*m[2]*m[13] + m[12]*m[1]*m[10] - m[12]*m[2]*m[9];
+    inv[2]  =  m[1]*m[6]*m[15]  - m[1]*m[7]*m[14]  - m[5]*m[2]*m[15] + m[5]*m[3]*m[14] + m[13]*m[2]*m[7]  - m[13]*m[3]*m[6];
+    inv[6]  = -m[0]*m[6]*m[15]  + m[0]*m[7]*m[14]  + m[4]*m[2]*m[15] - m[4]*m[3]*m[14] - m[12]*m[2]*m[7]  + m[12]*m[3]*m[6];
+    inv[10] =  m[0]*m[5]*m[15]  - m[0]*m[7]*m[13]  - m[4]*m[1]*m[15] + m[4]*m[3]*m[13] + m[12]*m[1]*m[7]  - m[12]*m[3]*m[5];
+    inv[14] = -m[0]*m[5]*m[14]  + m[0]*m[6]*m[13]  + m[4]*m[1]*m[14] - m[4]*m[2]*m[13] - m[12]*m[1]*m[6]  + m[12]*m[2]*m[5];
+    inv[3]  = -m[1]*m[6]*m[11]  + m[1]*m[7]*m[10]  + m[5]*m[2]*m[11] - m[5]*m[3]*m[10] - m[9]*m[2]*m[7]   + m[9]*m[3]*m[6];
+    inv[7]  =  m[0]*m[6]*m[11]  - m[0]*m[7]*m[10]  - m[4]*m[2]*m[11] + m[4]*m[3]*m[10] + m[8]*m[2]*m[7]   - m[8]*m[3]*m[6];
+    inv[11] = -m[0]*m[5]*m[11]  + m[0]*m[7]*m[9]   + m[4]*m[1]*m[11] - m[4]*m[3]*m[9]  - m[8]*m[1]*m[7]   + m[8]*m[3]*m[5];
+    inv[15] =  m[0]*m[5]*m[10]  - m[0]*m[6]*m[9]   - m[4]*m[1]*m[10] + m[4]*m[2]*m[9]  + m[8]*m[1]*m[6]   - m[8]*m[2]*m[5];
+
+    const float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+    if (det == 0.0f) return false;
+
+    const float invDet = 1.0f / det;
+    for (int i = 0; i < 16; ++i) out.m[i] = inv[i] * invDet;
+    return true;
+}
+
+// ------------------------------------------------------------
+// Affine3: 마지막 row가 (0,0,0,1)로 고정된 4x4. p' = A p + t
+// ------------------------------------------------------------
+
+struct Affine3 {
+    Vec3 c0, c1, c2; // A의 column
+    Vec3 t;
+};
+
+static inline Affine3 affine_identity() {
+    return { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 0.0f } };
+}
+
+static inline Mat4 to_mat4(const Affine3& a) {
+    return { { a.c0.x, a.c0.y, a.c0.z, 0.0f,
+               a.c1.x, a.c1.y, a.c1.z, 0.0f,
+               a.c2.x, a.c2.y, a.c2.z, 0.0f,
+               a.t.x,  a.t.y,  a.t.z,  1.0f } };
+}
+
+// 마지막 row는 (0,0,0,1)이라고 가정하고 버린다
+static inline Affine3 to_affine(const Mat4& m) {
+    return { { m.m[0],  m.m[1],  m.m[2]  },
+             { m.m[4],  m.m[5],  m.m[6]  },
+             { m.m[8],  m.m[9],  m.m[10] },
+             { m.m[12], m.m[13], m.m[14] } };
+}
+
+static inline Vec3 transform_point(const Affine3& a, Vec3 p) {
+    return add(add(add(scale(a.c0, p.x), scale(a.c1, p.y)), scale(a.c2, p.z)), a.t);
+}
+
+static inline Vec3 transform_dir(const Affine3& a, Vec3 d) {
+    return add(add(scale(a.c0, d.x), scale(a.c1, d.y)), scale(a.c2, d.z));
+}
+
+// (A_a, t_a)(A_b, t_b) = (A_a A_b, A_a t_b + t_a)
+static inline Affine3 mul(const Affine3& a, const Affine3& b) {
+    return { transform_dir(a, b.c0), transform_dir(a, b.c1), transform_dir(a, b.c2), transform_point(a, b.t) };
+}
+
+// 일반 affine 역: A^-1의 row는 (c1 x c2, c2 x c0, c0 x c1) / det, t' = -A^-1 t
+// 4x4 cofactor 전개 대비 곱셈 수가 1/3 이하이다.
+static inline bool inverse_affine(const Affine3& a, Affine3& out) {
+    const Vec3 r0 = cross(a.c1, a.c2);
+    const Vec3 r1 = cross(a.c2, a.c0);
+    const Vec3 r2 = cross(a.c0, a.c1);
+    const float det = dot(a.c0, r0);
+    if (det == 0.0f) return false;
+
+    const float inv = 1.0f / det;
+    const Vec3 s0 = scale(r0, inv), s1 = scale(r1, inv), s2 = scale(r2, inv);
+    out.c0 = { s0.x, s1.x, s2.x };
+    out.c1 = { s0.y, s1.y, s2.y };
+    out.c2 = { s0.z, s1.z, s2.z };
+    out.t  = { -dot(s0, a.t), -dot(s1, a.t), -dot(s2, a.t) };
+    return true;
+}
+
+// rigid(회전 + 이동, scale 없음): A가 직교행렬이므로 A^-1 = A^T, t' = -A^T t
+static inline Affine3 inverse_rigid(const Affine3& a) {
+    return { { a.c0.x, a.c1.x, a.c2.x },
+             { a.c0.y, a.c1.y, a.c2.y },
+             { a.c0.z, a.c1.z, a.c2.z },
+             { -dot(a.c0, a.t), -dot(a.c1, a.t), -dot(a.c2, a.t) } };
+}
+
+// ------------------------------------------------------------
+// Quaternion과 TRS 합성
+// ------------------------------------------------------------
+
+struct Quat {
+    float x, y, z, w;
+};
+
+static inline Quat quat_identity() {
+    return { 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+// 단위 축 axis 주위로 rad만큼 회전
+static inline Quat quat_from_axis_angle(Vec3 axis, float rad) {
+    const Vec3 n = normalize(axis);
+    const float s = std::sin(rad * 0.5f);
+    return { n.x * s, n.y * s, n.z * s, std::cos(rad * 0.5f) };
+}
+
+// a * b: b를 먼저, a를 나중에 적용 (행렬 곱과 같은 순서)
+static inline Quat quat_mul(Quat a, Quat b) {
+    return {
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+static inline Quat quat_normalize(Quat q) {
+    const float len = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    if (len == 0.0f) return quat_identity();
+    return { q.x / len, q.y / len, q.z / len, q.w / len };
+}
+
+// M = T * R(q) * S (CH3-2와 같은 순서: S 먼저, 그 다음 R, 마지막 T)
+// R의 column에 scale 성분을 곱하면 R*S가 되므로 행렬 곱 없이 바로 만든다.
+static inline Affine3 compose_trs(Vec3 t, Quat q, Vec3 s) {
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    Affine3 a;
+    a.c0 = scale({ 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy) }, s.x);
+    a.c1 = scale({ 2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx) }, s.y);
+    a.c2 = scale({ 2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy) }, s.z);
+    a.t  = t;
+    return a;
+}
+
+// ------------------------------------------------------------
+// Batch transform: point(w=1)는 translation을 받고, direction(w=0)은 받지 않는다 (CH3-4)
+// ------------------------------------------------------------
+//
+// 두 경우 모두 Mat4의 마지막 row는 (0,0,0,1)이라고 가정한다 (affine). perspective divide는 CH4에서 다룬다.
+
+static inline void transformPointsScalar(const Mat4& m, const float* in, float* out, size_t n) {
+    const Affine3 a = to_affine(m);
+    for (size_t i = 0; i < n; ++i) {
+        const Vec3 p = transform_point(a, { in[i * 3 + 0], in[i * 3 + 1], in[i * 3 + 2] });
+        out[i * 3 + 0] = p.x; out[i * 3 + 1] = p.y; out[i * 3 + 2] = p.z;
+    }
+}
+
+static inline void transformDirectionsScalar(const Mat4& m, const float* in, float* out, size_t n) {
+    const Affine3 a = to_affine(m);
+    for (size_t i = 0; i < n; ++i) {
+        const Vec3 d = transform_dir(a, { in[i * 3 + 0], in[i * 3 + 1], in[i * 3 + 2] });
+        out[i * 3 + 0] = d.x; out[i * 3 + 1] = d.y; out[i * 3 + 2] = d.z;
+    }
+}
+
+namespace detail {
+
+// AoS xyz 배열: 점 4개(float 12개)를 register 3개로 읽고 shuffle로 x/y/z register로 풀어
+// SoA와 같은 broadcast 곱을 한 뒤 다시 xyz 순서로 묶어 기록한다.
+// 점 하나를 register 하나에 넣는 방식은 lane 하나(w)가 놀고, 3-float 기록이 두 번의 store로 나뉘어 느리다.
+// w=1(point) / w=0(direction)은 column 3을 더할지 말지로 template 인자에서 고른다.
+template <bool IsPoint>
+static inline void transformAoS(const Mat4& m, const float* in, float* out, size_t n) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    __m128 k[12];
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 3; ++r) k[c * 3 + r] = _mm_set1_ps(m.m[c * 4 + r]);
+
+    for (; i + 4 <= n; i += 4) {
+        // v0 = x0 y0 z0 x1, v1 = y1 z1 x2 y2, v2 = z2 x3 y3 z3
+        const __m128 v0 = _mm_loadu_ps(in + i * 3 + 0);
+        const __m128 v1 = _mm_loadu_ps(in + i * 3 + 4);
+        const __m128 v2 = _mm_loadu_ps(in + i * 3 + 8);
+
+        const __m128 px = _mm_shuffle_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(0, 3, 0, 0)),
+                                         _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 py = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 0, 1)),
+                                         _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 pz = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 1, 0, 2)),
+                                         _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(0, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 rx = IsPoint ? k[9]  : _mm_setzero_ps();
+        __m128 ry = IsPoint ? k[10] : _mm_setzero_ps();
+        __m128 rz = IsPoint ? k[11] : _mm_setzero_ps();
+        rx = madd128(k[0], px, rx); ry = madd128(k[1], px, ry); rz = madd128(k[2], px, rz);
+        rx = madd128(k[3], py, rx); ry = madd128(k[4], py, ry); rz = madd128(k[5], py, rz);
+        rx = madd128(k[6], pz, rx); ry = madd128(k[7], pz, ry); rz = madd128(k[8], pz, rz);
+
+        // 4개 점을 모두 읽은 뒤에 기록하므로 in == out이어도 안전하다
+        const __m128 o0 = _mm_shuffle_ps(_mm_shuffle_ps(rx, ry, _MM_SHUFFLE(0, 0, 0, 0)),
+                                         _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(0, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 o1 = _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(0, 1, 0, 1)),
+                                         _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(0, 2, 0, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 o2 = _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(0, 3, 0, 2)),
+                                         _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(0, 3, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(out + i * 3 + 0, o0);
+        _mm_storeu_ps(out + i * 3 + 4, o1);
+        _mm_storeu_ps(out + i * 3 + 8, o2);
+    }
+#endif
+    if (IsPoint) transformPointsScalar(m, in + i * 3, out + i * 3, n - i);
+    else         transformDirectionsScalar(m, in + i * 3, out + i * 3, n - i);
+}
+
+// SoA x[], y[], z[] 배열: 점 8개(AVX) / 4개(SSE)를 한 번에. matrix 원소는 모두 broadcast 상수가 된다.
+template <bool IsPoint>
+static inline void transformSoA(const Mat4& m, const float* x, const float* y, const float* z,
+                                float* ox, float* oy, float* oz, size_t n) {
+    size_t i = 0;
+#if defined(__AVX__)
+    __m256 k[12];
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 3; ++r) k[c * 3 + r] = _mm256_set1_ps(m.m[c * 4 + r]);
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256 px = _mm256_loadu_ps(x + i);
+        const __m256 py = _mm256_loadu_ps(y + i);
+        const __m256 pz = _mm256_loadu_ps(z + i);
+        __m256 rx = IsPoint ? k[9]  : _mm256_setzero_ps();
+        __m256 ry = IsPoint ? k[10] : _mm256_setzero_ps();
+        __m256 rz = IsPoint ? k[11] : _mm256_setzero_ps();
+        rx = madd256(k[0], px, rx); ry = madd256(k[1], px, ry); rz = madd256(k[2], px, rz);
+        rx = madd256(k[3], py, rx); ry = madd256(k[4], py, ry); rz = madd256(k[5], py, rz);
+        rx = madd256(k[6], pz, rx); ry = madd256(k[7], pz, ry); rz = madd256(k[8], pz, rz);
+        _mm256_storeu_ps(ox + i, rx);
+        _mm256_storeu_ps(oy + i, ry);
+        _mm256_storeu_ps(oz + i, rz);
+    }
+#elif defined(__SSE2__)
+    __m128 k[12];
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 3; ++r) k[c * 3 + r] = _mm_set1_ps(m.m[c * 4 + r]);
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128 px = _mm_loadu_ps(x + i);
+        const __m128 py = _mm_loadu_ps(y + i);
+        const __m128 pz = _mm_loadu_ps(z + i);
+        __m128 rx = IsPoint ? k[9]  : _mm_setzero_ps();
+        __m128 ry = IsPoint ? k[10] : _mm_setzero_ps();
+        __m128 rz = IsPoint ? k[11] : _mm_setzero_ps();
+        rx = madd128(k[0], px, rx); ry = madd128(k[1], px, ry); rz = madd128(k[2], px, rz);
+        rx = madd128(k[3], py, rx); ry = madd128(k[4], py, ry); rz = madd128(k[5], py, rz);
+        rx = madd128(k[6], pz, rx); ry = madd128(k[7], pz, ry); rz = madd128(k[8], pz, rz);
+        _mm_storeu_ps(ox + i, rx);
+        _mm_storeu_ps(oy + i, ry);
+        _mm_storeu_ps(oz + i, rz);
+    }
+#endif
+    const Affine3 a = to_affine(m);
+    for (; i < n; ++i) {
+        const Vec3 p = { x[i], y[i], z[i] };
+        const Vec3 r = IsPoint ? transform_point(a, p) : transform_dir(a, p);
+        ox[i] = r.x; oy[i] = r.y; oz[i] = r.z;
+    }
+}
+
+} // namespace detail
+
+static inline void transformPoints(const Mat4& m, const float* in, float* out, size_t n) {
+    detail::transformAoS<true>(m, in, out, n);
+}
+
+static inline void transformDirections(const Mat4& m, const float* in, float* out, size_t n) {
+    detail::transformAoS<false>(m, in, out, n);
+}
+
+static inline void transformPointsSoA(const Mat4& m, const float* x, const float* y, const float* z,
+                                      float* ox, float* oy, float* oz, size_t n) {
+    detail::transformSoA<true>(m, x, y, z, ox, oy, oz, n);
+}
+
+static inline void transformDirectionsSoA(const Mat4& m, const float* x, const float* y, const float* z,
+                                          float* ox, float* oy, float* oz, size_t n) {
+    detail::transformSoA<false>(m, x, y, z, ox, oy, oz, n);
+}
+
+} // namespace cg101
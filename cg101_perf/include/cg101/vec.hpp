@@ -0,0 +1,80 @@
+// include/cg101/vec.hpp
+#pragma once
+#include <cmath>
+
+namespace cg101 {
+
+// CH2-1/2-2/2-5의 2D vector 함수
+struct Vec2 {
+    float x, y;
+};
+
+static inline float dot(Vec2 a, Vec2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+static inline float length(Vec2 v) {
+    return std::sqrt(dot(v, v));
+}
+
+static inline Vec2 normalize(Vec2 v) {
+    float len = length(v);
+    if (len == 0.0f) return { 0.0f, 0.0f };
+    else             return { v.x / len, v.y / len };
+}
+
+static inline float clamp(float x, float lo, float hi) {
+    return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+// 두 방향 사이의 각 (rad): acos(clamp(dot(a^, b^), -1, 1))
+static inline float angle_between(Vec2 a, Vec2 b) {
+    return std::acos(clamp(dot(normalize(a), normalize(b)), -1.0f, 1.0f));
+}
+
+static inline Vec2 rotate(Vec2 v, float theta_rad) {
+    const float c = std::cos(theta_rad);
+    const float s = std::sin(theta_rad);
+    return { v.x * c - v.y * s, v.x * s + v.y * c };
+}
+
+// CH2-3의 scalar vector 함수 (batched kernel들의 기준 구현으로도 사용)
+struct Vec3 {
+    float x, y, z;
+};
+
+static inline Vec3 add(Vec3 a, Vec3 b) {
+    return { a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+static inline Vec3 sub(Vec3 a, Vec3 b) {
+    return { a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+static inline Vec3 scale(Vec3 v, float s) {
+    return { v.x * s, v.y * s, v.z * s };
+}
+
+static inline float dot(Vec3 a, Vec3 b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static inline Vec3 cross(Vec3 a, Vec3 b) {
+    return {
+        a.y * b.z - a.z * b.y,
+        a.z * b.x - a.x * b.z,
+        a.x * b.y - a.y * b.x
+    };
+}
+
+static inline float length(Vec3 v) {
+    return std::sqrt(dot(v, v));
+}
+
+static inline Vec3 normalize(Vec3 v) {
+    float len = length(v);
+    if (len == 0) return { 0.0f, 0.0f, 0.0f };
+    else          return { v.x / len, v.y / len, v.z / len };
+}
+
+} // namespace cg101
@@ -0,0 +1,504 @@
+// include/cg101/vertex_format.hpp
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <glad/glad.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace cg101 {
+
+// CH1의 glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, ...)는 "VBO의 raw bytes를 어떻게 해석할지"의 규칙이다.
+// 같은 vec2/vec3 attribute라도 bytes를 더 작은 type으로 저장하고, GPU가 fetch 시점에 float로 되돌리게 할 수 있다.
+//
+//  - Half16      : IEEE half (GL_HALF_FLOAT), 유효숫자 ~3자리
+//  - Snorm16/8   : [-1,1] 고정소수점, c / (2^(b-1)-1) 로 복원 (normalized = GL_TRUE)
+//  - Unorm16/8   : [0,1]  고정소수점, c / (2^b-1) 로 복원
+//  - Snorm10_10_10_2 : xyz 10bit + w 2bit를 4byte 하나에 pack (GL_INT_2_10_10_10_REV), normal/tangent용
+enum class AttribType : uint8_t {
+    Float32,
+    Half16,
+    Snorm16,
+    Unorm16,
+    Snorm8,
+    Unorm8,
+    Snorm10_10_10_2,
+};
+
+static inline GLenum glComponentType(AttribType t) {
+    switch (t) {
+        case AttribType::Float32:         return GL_FLOAT;
+        case AttribType::Half16:          return GL_HALF_FLOAT;
+        case AttribType::Snorm16:         return GL_SHORT;
+        case AttribType::Unorm16:         return GL_UNSIGNED_SHORT;
+        case AttribType::Snorm8:          return GL_BYTE;
+        case AttribType::Unorm8:          return GL_UNSIGNED_BYTE;
+        case AttribType::Snorm10_10_10_2: return GL_INT_2_10_10_10_REV;
+    }
+    return GL_FLOAT;
+}
+
+static inline GLboolean glNormalized(AttribType t) {
+    return (t == AttribType::Float32 || t == AttribType::Half16) ? GL_FALSE : GL_TRUE;
+}
+
+// attribute 1개가 정점 안에서 차지하는 byte 수
+static inline GLuint attribBytes(AttribType t, GLint components) {
+    switch (t) {
+        case AttribType::Float32:         return 4u * components;
+        case AttribType::Half16:          return 2u * components;
+        case AttribType::Snorm16:         return 2u * components;
+        case AttribType::Unorm16:         return 2u * components;
+        case AttribType::Snorm8:          return 1u * components;
+        case AttribType::Unorm8:          return 1u * components;
+        case AttribType::Snorm10_10_10_2: return 4u;
+    }
+    return 0;
+}
+
+struct AttribDesc {
+    GLuint     location;
+    AttribType type;
+    GLint      components; // CPU 쪽 float 개수 (1..4). packed type은 3(normal) 또는 4(tangent + handedness)
+    GLuint     offset;     // 정점 시작부터의 byte offset
+};
+
+// interleaved 정점 하나의 layout. attribute는 4byte 경계에 정렬한다 (대부분의 GPU fetch 단위).
+class VertexLayout {
+public:
+    VertexLayout& add(GLuint location, AttribType type, GLint components) {
+        GLuint offset = align4(size_);
+        attribs_.push_back({ location, type, components, offset });
+        size_ = offset + attribBytes(type, components);
+        return *this;
+    }
+
+    GLuint stride() const { return align4(size_); }
+    const std::vector<AttribDesc>& attribs() const { return attribs_; }
+
+    // GL 3.3 경로: VAO와 GL_ARRAY_BUFFER가 바인딩된 상태에서 호출한다.
+    void applyPointers(GLintptr baseOffset = 0) const {
+        for (const AttribDesc& a : attribs_) {
+            glVertexAttribPointer(a.location, glComponents(a), glComponentType(a.type),
+                                  glNormalized(a.type), (GLsizei)stride(),
+                                  (const void*)(baseOffset + (GLintptr)a.offset));
+            glEnableVertexAttribArray(a.location);
+        }
+    }
+
+    // GL 4.3 separate attribute format 경로: format은 VAO에 한 번만 기록하고,
+    // buffer는 glBindVertexBuffer(binding, vbo, offset, stride())로 따로 교체한다.
+    void applyFormat(GLuint binding) const {
+        for (const AttribDesc& a : attribs_) {
+            glVertexAttribFormat(a.location, glComponents(a), glComponentType(a.type),
+                                 glNormalized(a.type), a.offset);
+            glVertexAttribBinding(a.location, binding);
+            glEnableVertexAttribArray(a.location);
+        }
+    }
+
+private:
+    static GLuint align4(GLuint n) { return (n + 3u) & ~3u; }
+
+    // GL_INT_2_10_10_10_REV는 size가 항상 4여야 한다 (shader에서 vec3로 받으면 w는 무시됨)
+    static GLint glComponents(const AttribDesc& a) {
+        return a.type == AttribType::Snorm10_10_10_2 ? 4 : a.components;
+    }
+
+    std::vector<AttribDesc> attribs_;
+    GLuint size_ = 0;
+};
+
+// ------------------------------------------------------------
+// Scalar encode/decode (정의 그대로의 기준 구현. encodeAttrib의 SIMD 경로는 vertex_formats에서 이것과 bit 단위로 비교한다)
+// ------------------------------------------------------------
+
+static inline float clampf(float x, float lo, float hi) {
+    return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+// float -> half, round-to-nearest-even (F16C의 _MM_FROUND_TO_NEAREST_INT와 같은 결과)
+static inline uint16_t float_to_half(float f) {
+    uint32_t x;
+    std::memcpy(&x, &f, 4);
+
+    const uint32_t sign = (x >> 16) & 0x8000u;
+    const uint32_t fexp = (x >> 23) & 0xFFu;
+    uint32_t mant = x & 0x7FFFFFu;
+
+    if (fexp == 0xFFu) return (uint16_t)(sign | 0x7C00u | (mant ? 0x200u : 0u)); // inf / nan
+
+    const int32_t exp = (int32_t)fexp - 127 + 15;
+    if (exp >= 31) return (uint16_t)(sign | 0x7C00u); // overflow -> inf
+
+    if (exp <= 0) {
+        // half subnormal: m * 2^-24
+        if (exp < -10) return (uint16_t)sign;
+        mant |= 0x800000u;
+        const uint32_t shift   = (uint32_t)(14 - exp);
+        uint32_t       h       = mant >> shift;
+        const uint32_t rem     = mant & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (rem > halfway || (rem == halfway && (h & 1u))) ++h;
+        return (uint16_t)(sign | h);
+    }
+
+    uint32_t h = sign | ((uint32_t)exp << 10) | (mant >> 13);
+    const uint32_t rem = mant & 0x1FFFu;
+    if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) ++h; // mantissa carry는 exponent로 자연스럽게 올라간다
+    return (uint16_t)h;
+}
+
+static inline float half_to_float(uint16_t h) {
+    const uint32_t exp  = (h >> 10) & 0x1Fu;
+    const uint32_t mant = h & 0x3FFu;
+
+    float f;
+    if (exp == 0)       f = std::ldexp((float)mant, -24);
+    else if (exp == 31) f = mant ? NAN : INFINITY;
+    else                f = std::ldexp((float)(mant | 0x400u), (int)exp - 25);
+    return (h & 0x8000u) ? -f : f;
+}
+
+static inline int16_t float_to_snorm16(float x) {
+    return (int16_t)std::lrintf(clampf(x, -1.0f, 1.0f) * 32767.0f);
+}
+
+static inline float snorm16_to_float(int16_t c) {
+    return std::fmax((float)c / 32767.0f, -1.0f);
+}
+
+static inline uint16_t float_to_unorm16(float x) {
+    return (uint16_t)std::lrintf(clampf(x, 0.0f, 1.0f) * 65535.0f);
+}
+
+static inline float unorm16_to_float(uint16_t c) {
+    return (float)c / 65535.0f;
+}
+
+static inline int8_t float_to_snorm8(float x) {
+    return (int8_t)std::lrintf(clampf(x, -1.0f, 1.0f) * 127.0f);
+}
+
+static inline float snorm8_to_float(int8_t c) {
+    return std::fmax((float)c / 127.0f, -1.0f);
+}
+
+static inline uint8_t float_to_unorm8(float x) {
+    return (uint8_t)std::lrintf(clampf(x, 0.0f, 1.0f) * 255.0f);
+}
+
+static inline float unorm8_to_float(uint8_t c) {
+    return (float)c / 255.0f;
+}
+
+// bit layout (REV): x = [0,10), y = [10,20), z = [20,30), w = [30,32)
+static inline uint32_t pack_snorm_2_10_10_10(float x, float y, float z, float w) {
+    const int32_t ix = (int32_t)std::lrintf(clampf(x, -1.0f, 1.0f) * 511.0f);
+    const int32_t iy = (int32_t)std::lrintf(clampf(y, -1.0f, 1.0f) * 511.0f);
+    const int32_t iz = (int32_t)std::lrintf(clampf(z, -1.0f, 1.0f) * 511.0f);
+    const int32_t iw = (int32_t)std::lrintf(clampf(w, -1.0f, 1.0f));
+    return ((uint32_t)ix & 0x3FFu)
+         | (((uint32_t)iy & 0x3FFu) << 10)
+         | (((uint32_t)iz & 0x3FFu) << 20)
+         | (((uint32_t)iw & 0x3u)   << 30);
+}
+
+static inline void unpack_snorm_2_10_10_10(uint32_t p, float out[4]) {
+    // 부호 확장: 상위 bit까지 밀어 올린 뒤 arithmetic shift
+    const int32_t ix = (int32_t)(p << 22) >> 22;
+    const int32_t iy = (int32_t)(p << 12) >> 22;
+    const int32_t iz = (int32_t)(p << 2)  >> 22;
+    const int32_t iw = (int32_t)p >> 30;
+    out[0] = std::fmax((float)ix / 511.0f, -1.0f);
+    out[1] = std::fmax((float)iy / 511.0f, -1.0f);
+    out[2] = std::fmax((float)iz / 511.0f, -1.0f);
+    out[3] = std::fmax((float)iw, -1.0f);
+}
+
+// ------------------------------------------------------------
+// Position quantization: AABB를 [-1,1] (snorm) 또는 [0,1] (unorm)로 옮기는 remap
+// ------------------------------------------------------------
+
+// encode 직전에 x' = x*scale + bias 를 적용한다.
+// shader에서는 역변환 p = q*decodeScale + decodeBias 를 uniform으로 적용한다.
+struct AttribRemap {
+    float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float bias[4]  = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float decodeScale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float decodeBias[4]  = { 0.0f, 0.0f, 0.0f, 0.0f };
+};
+
+// src: n개 원소 x components float (tightly packed). signedRange면 [-1,1], 아니면 [0,1]로 보낸다.
+static inline AttribRemap boundsRemap(const float* src, size_t n, int components, bool signedRange) {
+    float lo[4] = {  INFINITY,  INFINITY,  INFINITY,  INFINITY };
+    float hi[4] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+    for (size_t i = 0; i < n; ++i) {
+        for (int c = 0; c < components; ++c) {
+            float v = src[i * components + c];
+            lo[c] = std::fmin(lo[c], v);
+            hi[c] = std::fmax(hi[c], v);
+        }
+    }
+
+    AttribRemap r;
+    for (int c = 0; c < components; ++c) {
+        float ext = hi[c] - lo[c];
+        if (!(ext > 0.0f)) ext = 1.0f; // 모든 값이 같은 축 (degenerate)
+        if (signedRange) {
+            r.scale[c] = 2.0f / ext;
+            r.bias[c]  = -(lo[c] + hi[c]) / ext;
+            r.decodeScale[c] = ext * 0.5f;
+            r.decodeBias[c]  = (lo[c] + hi[c]) * 0.5f;
+        } else {
+            r.scale[c] = 1.0f / ext;
+            r.bias[c]  = -lo[c] / ext;
+            r.decodeScale[c] = ext;
+            r.decodeBias[c]  = lo[c];
+        }
+    }
+    return r;
+}
+
+// ------------------------------------------------------------
+// Bulk encoder: float stream -> interleaved VBO 안의 attribute 슬롯
+// ------------------------------------------------------------
+
+namespace detail {
+
+#if defined(__SSE2__)
+static inline __m128 loadPartial(const float* p, int n) {
+    if (n == 4) return _mm_loadu_ps(p);
+    float t[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < n; ++i) t[i] = p[i];
+    return _mm_loadu_ps(t);
+}
+
+static inline void storePartial(void* dst, __m128i v, size_t bytes) {
+    alignas(16) uint8_t t[16];
+    _mm_store_si128((__m128i*)t, v);
+    std::memcpy(dst, t, bytes);
+}
+#endif
+
+static inline void encodeScalar(AttribType type, int comps, const float* s, uint8_t* d) {
+    switch (type) {
+        case AttribType::Float32:
+            std::memcpy(d, s, 4u * comps);
+            break;
+        case AttribType::Half16:
+            for (int c = 0; c < comps; ++c) {
+                uint16_t h = float_to_half(s[c]);
+                std::memcpy(d + 2 * c, &h, 2);
+            }
+            break;
+        case AttribType::Snorm16:
+            for (int c = 0; c < comps; ++c) {
+                int16_t q = float_to_snorm16(s[c]);
+                std::memcpy(d + 2 * c, &q, 2);
+            }
+            break;
+        case AttribType::Unorm16:
+            for (int c = 0; c < comps; ++c) {
+                uint16_t q = float_to_unorm16(s[c]);
+                std::memcpy(d + 2 * c, &q, 2);
+            }
+            break;
+        case AttribType::Snorm8:
+            for (int c = 0; c < comps; ++c) d[c] = (uint8_t)float_to_snorm8(s[c]);
+            break;
+        case AttribType::Unorm8:
+            for (int c = 0; c < comps; ++c) d[c] = float_to_unorm8(s[c]);
+            break;
+        case AttribType::Snorm10_10_10_2: {
+            // 없는 성분은 0 (comps < 3일 때 caller의 배열 밖을 읽지 않는다)
+            uint32_t p = pack_snorm_2_10_10_10(s[0], comps > 1 ? s[1] : 0.0f, comps > 2 ? s[2] : 0.0f,
+                                               comps > 3 ? s[3] : 0.0f);
+            std::memcpy(d, &p, 4);
+            break;
+        }
+    }
+}
+
+} // namespace detail
+
+// n개 원소를 인코딩해 dst(첫 정점의 attribute 위치)부터 dstStride 간격으로 기록한다.
+// remap이 주어지면 인코딩 전에 x*scale + bias를 적용한다 (position quantization).
+static inline void encodeAttrib(AttribType type, int comps, const float* src, size_t n,
+                                void* dst, size_t dstStride, const AttribRemap* remap = nullptr) {
+    uint8_t* d = (uint8_t*)dst;
+    const size_t bytes = attribBytes(type, comps);
+
+#if defined(__SSE2__)
+    // comps 밖의 lane은 scale/bias 모두 0 (10_10_10_2처럼 4 lane을 함께 pack하는 type에서 없는 성분 = 0).
+    // remap이 없을 때 bias는 -0: x + (-0) = x 이므로 -0 입력의 부호가 scalar 경로처럼 유지된다.
+    const __m128 scale = remap ? detail::loadPartial(remap->scale, comps) : _mm_set1_ps(1.0f);
+    const __m128 bias  = remap ? detail::loadPartial(remap->bias, comps)  : _mm_set1_ps(-0.0f);
+    const __m128 one   = _mm_set1_ps(1.0f);
+    const __m128 mone  = _mm_set1_ps(-1.0f);
+    const __m128 zero  = _mm_setzero_ps();
+
+    // 원소 하나 = SSE lane 4개 (components <= 4). 변환 + clamp + 정수화 + pack을 한 번에 처리한다.
+    switch (type) {
+        case AttribType::Float32:
+            if (!remap) {
+                for (size_t i = 0; i < n; ++i) std::memcpy(d + i * dstStride, src + i * comps, bytes);
+                return;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                detail::storePartial(d + i * dstStride, _mm_castps_si128(v), bytes);
+            }
+            return;
+
+#if defined(__F16C__)
+        case AttribType::Half16:
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                detail::storePartial(d + i * dstStride, _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT), bytes);
+            }
+            return;
+#endif
+
+        case AttribType::Snorm16: {
+            const __m128 k = _mm_set1_ps(32767.0f);
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, mone), one), k);
+                __m128i q = _mm_cvtps_epi32(v); // MXCSR 기본값 = round-to-nearest-even (lrintf와 동일)
+                detail::storePartial(d + i * dstStride, _mm_packs_epi32(q, q), bytes);
+            }
+            return;
+        }
+
+#if defined(__SSE4_1__)
+        case AttribType::Unorm16: {
+            const __m128 k = _mm_set1_ps(65535.0f);
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, zero), one), k);
+                __m128i q = _mm_cvtps_epi32(v);
+                detail::storePartial(d + i * dstStride, _mm_packus_epi32(q, q), bytes);
+            }
+            return;
+        }
+#endif
+
+        case AttribType::Snorm8: {
+            const __m128 k = _mm_set1_ps(127.0f);
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, mone), one), k);
+                __m128i q = _mm_cvtps_epi32(v);
+                q = _mm_packs_epi32(q, q);
+                detail::storePartial(d + i * dstStride, _mm_packs_epi16(q, q), bytes);
+            }
+            return;
+        }
+
+        case AttribType::Unorm8: {
+            const __m128 k = _mm_set1_ps(255.0f);
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, zero), one), k);
+                __m128i q = _mm_cvtps_epi32(v);
+                q = _mm_packs_epi32(q, q);
+                detail::storePartial(d + i * dstStride, _mm_packus_epi16(q, q), bytes);
+            }
+            return;
+        }
+
+#if defined(__SSE4_1__)
+        case AttribType::Snorm10_10_10_2: {
+            // lane별 scale (511,511,511,1) -> 정수화 -> lane별 mask -> lane별 shift(곱셈) -> 4 lane OR
+            const __m128  k     = _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f);
+            const __m128i mask  = _mm_setr_epi32(0x3FF, 0x3FF, 0x3FF, 0x3);
+            const __m128i shift = _mm_setr_epi32(1, 1 << 10, 1 << 20, 1 << 30);
+            for (size_t i = 0; i < n; ++i) {
+                __m128 v = _mm_add_ps(_mm_mul_ps(detail::loadPartial(src + i * comps, comps), scale), bias);
+                v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, mone), one), k);
+                __m128i q = _mm_mullo_epi32(_mm_and_si128(_mm_cvtps_epi32(v), mask), shift);
+                q = _mm_or_si128(q, _mm_shuffle_epi32(q, _MM_SHUFFLE(1, 0, 3, 2)));
+                q = _mm_or_si128(q, _mm_shuffle_epi32(q, _MM_SHUFFLE(2, 3, 0, 1)));
+                uint32_t p = (uint32_t)_mm_cvtsi128_si32(q);
+                std::memcpy(d + i * dstStride, &p, 4);
+            }
+            return;
+        }
+#endif
+
+        default:
+            break; // 해당 instruction set이 없으면 아래 scalar 경로
+    }
+#endif
+
+    float tmp[4];
+    for (size_t i = 0; i < n; ++i) {
+        const float* s = src + i * comps;
+        if (remap) {
+            for (int c = 0; c < comps; ++c) tmp[c] = s[c] * remap->scale[c] + remap->bias[c];
+            s = tmp;
+        }
+        detail::encodeScalar(type, comps, s, d + i * dstStride);
+    }
+}
+
+// 검증/디버깅용: attribute 슬롯 하나를 float로 되돌린다 (GPU fetch와 같은 규칙, remap 역변환 포함)
+static inline void decodeAttrib(AttribType type, int comps, const void* src, float out[4],
+                                const AttribRemap* remap = nullptr) {
+    const uint8_t* s = (const uint8_t*)src;
+    // comps 밖의 lane은 GPU fetch와 같은 기본값 (0, 0, 0, 1)
+    out[0] = 0.0f; out[1] = 0.0f; out[2] = 0.0f; out[3] = 1.0f;
+    switch (type) {
+        case AttribType::Float32:
+            std::memcpy(out, s, 4u * comps);
+            break;
+        case AttribType::Half16:
+            for (int c = 0; c < comps; ++c) {
+                uint16_t h;
+                std::memcpy(&h, s + 2 * c, 2);
+                out[c] = half_to_float(h);
+            }
+            break;
+        case AttribType::Snorm16:
+            for (int c = 0; c < comps; ++c) {
+                int16_t q;
+                std::memcpy(&q, s + 2 * c, 2);
+                out[c] = snorm16_to_float(q);
+            }
+            break;
+        case AttribType::Unorm16:
+            for (int c = 0; c < comps; ++c) {
+                uint16_t q;
+                std::memcpy(&q, s + 2 * c, 2);
+                out[c] = unorm16_to_float(q);
+            }
+            break;
+        case AttribType::Snorm8:
+            for (int c = 0; c < comps; ++c) out[c] = snorm8_to_float((int8_t)s[c]);
+            break;
+        case AttribType::Unorm8:
+            for (int c = 0; c < comps; ++c) out[c] = unorm8_to_float(s[c]);
+            break;
+        case AttribType::Snorm10_10_10_2: {
+            uint32_t p;
+            std::memcpy(&p, s, 4);
+            float v[4];
+            unpack_snorm_2_10_10_10(p, v);
+            for (int c = 0; c < comps; ++c) out[c] = v[c];
+            break;
+        }
+    }
+
+    if (remap) {
+        for (int c = 0; c < comps; ++c) out[c] = out[c] * remap->decodeScale[c] + remap->decodeBias[c];
+    }
+}
+
+} // namespace cg101
@@ -0,0 +1,496 @@
+// src/cg101_bench.cpp
+// perf-8: 통합 benchmark suite
+//   - ch2: vector 함수 (normalize, 두 방향 사이 각, 2D 회전, face normal)
+//   - ch3: matrix 합성 (Mat4 곱, T*R*S 합성, 역행렬, point 변환)
+//   - gl : headless GL 제출 경로 (draw마다 uniform, instanced, buffer upload, 빈 frame)
+// 결과를 JSON으로 저장하고, 저장된 baseline과 비교해 threshold 이상 느려진 항목을 회귀로 표시한다 (종료 코드 1).
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_util.hpp>
+#include <cg101/timer.hpp>
+#include <cg101/transform.hpp>
+#include <cg101/vec.hpp>
+
+using namespace cg101;
+
+// 결과를 쓰지 않는 loop를 compiler가 지우지 않도록 값을 "사용"한다
+template <class T>
+static inline void doNotOptimize(const T& v) {
+    asm volatile("" : : "r,m"(v) : "memory");
+}
+
+static float hash01(uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352du;
+    x ^= x >> 15; x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+struct BenchResult {
+    std::string name;
+    double medianNs = 0.0;  // op 하나당
+    double minNs    = 0.0;
+    size_t opsPerRun = 0;
+    int    reps      = 0;   // sample 하나에 포함된 run 수
+    int    samples   = 0;
+};
+
+struct BenchConfig {
+    int         samples     = 7;
+    double      sampleMs    = 20.0;  // sample 하나의 목표 시간
+    double      threshold   = 0.15;  // baseline 대비 허용 비율 (ch2/ch3 CPU 항목)
+    double      glThreshold = 0.30;  // gl.* 항목의 허용 비율 (llvmpipe는 CPU 항목보다 크게 흔들린다)
+    const char* filter      = nullptr;
+    const char* outPath   = nullptr;
+    const char* baseline  = nullptr;
+    bool        gl        = true;
+    std::vector<BenchResult> base; // --baseline에서 읽은 값
+};
+
+static const BenchResult* findResult(const std::vector<BenchResult>& v, const std::string& name) {
+    for (const BenchResult& r : v)
+        if (r.name == name) return &r;
+    return nullptr;
+}
+
+// 항목을 등록만 해 두고 run()이 한꺼번에 잰다. fn()은 op opsPerRun개를 실행한다.
+//   1) 항목마다 warm-up 1회(shader JIT, page fault 등 첫 실행 비용) 뒤 1회를 재서 sample 하나가 sampleMs가 되도록 반복 횟수를 정하고
+//   2) samples 라운드 동안 라운드마다 모든 항목의 sample을 하나씩 잰다.
+// 공유 CPU에서는 수백 ms 동안 다른 process에 밀리는 구간이 생긴다. 항목별로 sample을 몰아서 재면 그 구간이 한 항목의
+// sample 전부를 망치지만, 라운드로 섞어 재면 항목마다 sample 한두 개만 느려지고 최소값은 그대로 남는다.
+class BenchSet {
+public:
+    explicit BenchSet(const BenchConfig& cfg) : cfg_(cfg) {}
+
+    // 다음에 등록하는 항목 앞에 출력할 제목
+    void section(const char* title) { pendingTitle_ = title; }
+
+    template <class Fn>
+    void add(const char* name, size_t opsPerRun, Fn&& fn) {
+        if (cfg_.filter && !std::strstr(name, cfg_.filter)) return;
+        Bench b;
+        b.name      = name;
+        b.title     = pendingTitle_;
+        b.opsPerRun = opsPerRun;
+        b.fn        = std::forward<Fn>(fn);
+        benches_.push_back(std::move(b));
+        pendingTitle_ = nullptr;
+    }
+
+    void run(std::vector<BenchResult>& out) {
+        for (Bench& b : benches_) {
+            b.fn();
+            Stopwatch sw;
+            b.fn();
+            const double once = std::max(sw.elapsed_ms(), 1e-4);
+            b.reps = (int)std::clamp(std::ceil(cfg_.sampleMs / once), 1.0, 1e6);
+        }
+        for (int s = 0; s < cfg_.samples; ++s) {
+            for (Bench& b : benches_) {
+                Stopwatch sw;
+                for (int r = 0; r < b.reps; ++r) b.fn();
+                b.ns.push_back(sw.elapsed_ms() * 1e6 / ((double)b.reps * (double)b.opsPerRun));
+            }
+        }
+
+        for (Bench& b : benches_) {
+            std::sort(b.ns.begin(), b.ns.end());
+            BenchResult r;
+            r.name      = b.name;
+            r.medianNs  = b.ns[b.ns.size() / 2];
+            r.minNs     = b.ns.front();
+            r.opsPerRun = b.opsPerRun;
+            r.reps      = b.reps;
+            r.samples   = cfg_.samples;
+            if (b.title) std::printf("%s\n", b.title);
+            std::printf("  %-32s %12.3f ns/op  (min %.3f, %zu ops x %d reps x %d samples)\n",
+                        r.name.c_str(), r.medianNs, r.minNs, r.opsPerRun, r.reps, r.samples);
+            out.push_back(r);
+        }
+        benches_.clear();
+    }
+
+private:
+    struct Bench {
+        const char*           name  = nullptr;
+        const char*           title = nullptr;
+        size_t                opsPerRun = 0;
+        int                   reps = 0;
+        std::function<void()> fn;
+        std::vector<double>   ns;
+    };
+
+    const BenchConfig& cfg_;
+    std::vector<Bench> benches_;
+    const char*        pendingTitle_ = nullptr;
+};
+
+// ------------------------------------------------------------
+// ch2 / ch3: CPU math
+// ------------------------------------------------------------
+
+static void benchMath(std::vector<BenchResult>& out, const BenchConfig& cfg) {
+    BenchSet set(cfg);
+    const size_t n = 4096;
+    std::vector<Vec2> a(n), b(n), r2(n);
+    std::vector<Vec3> p0(n), p1(n), p2(n), r3(n);
+    std::vector<float> ang(n), rf(n);
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t h = (uint32_t)i * 16u;
+        a[i]   = { hash01(h + 0) * 2.0f - 1.0f, hash01(h + 1) * 2.0f - 1.0f };
+        b[i]   = { hash01(h + 2) * 2.0f - 1.0f, hash01(h + 3) * 2.0f - 1.0f };
+        ang[i] = hash01(h + 4) * 6.2831853f;
+        p0[i]  = { hash01(h + 5), hash01(h + 6), hash01(h + 7) };
+        p1[i]  = { hash01(h + 8), hash01(h + 9), hash01(h + 10) };
+        p2[i]  = { hash01(h + 11), hash01(h + 12), hash01(h + 13) };
+    }
+
+    set.section("[ch2: vector functions]");
+    set.add("ch2.vec2_normalize", n, [&] {
+        for (size_t i = 0; i < n; ++i) r2[i] = normalize(a[i]);
+        doNotOptimize(r2[n - 1]);
+    });
+    set.add("ch2.vec2_angle_between", n, [&] {
+        for (size_t i = 0; i < n; ++i) rf[i] = angle_between(a[i], b[i]);
+        doNotOptimize(rf[n - 1]);
+    });
+    set.add("ch2.vec2_rotate", n, [&] {
+        for (size_t i = 0; i < n; ++i) r2[i] = rotate(a[i], ang[i]);
+        doNotOptimize(r2[n - 1]);
+    });
+    set.add("ch2.vec3_face_normal", n, [&] {
+        for (size_t i = 0; i < n; ++i) r3[i] = normalize(cross(sub(p1[i], p0[i]), sub(p2[i], p0[i])));
+        doNotOptimize(r3[n - 1]);
+    });
+
+    // ---- ch3 ----
+    const size_t m = 1024;
+    std::vector<Mat4> A(m), B(m), C(m);
+    std::vector<Affine3> AA(m), AC(m);
+    std::vector<Vec3> t(m), s(m), axis(m);
+    std::vector<float> rad(m);
+    for (size_t i = 0; i < m; ++i) {
+        const uint32_t h = (uint32_t)i * 16u + 99991u;
+        t[i]    = { hash01(h + 0) * 10.0f, hash01(h + 1) * 10.0f, hash01(h + 2) * 10.0f };
+        s[i]    = { 0.5f + hash01(h + 3), 0.5f + hash01(h + 4), 0.5f + hash01(h + 5) };
+        axis[i] = { 0.0f, 0.0f, 1.0f };
+        rad[i]  = hash01(h + 6) * 6.2831853f;
+        AA[i]   = compose_trs(t[i], quat_from_axis_angle({ hash01(h + 7) - 0.5f, hash01(h + 8) - 0.5f, 0.3f }, rad[i]), s[i]);
+        A[i]    = to_mat4(AA[i]);
+        B[i]    = to_mat4(compose_trs(s[i], quat_from_axis_angle(axis[i], -rad[i]), t[i]));
+    }
+
+    set.section("[ch3: matrix composition]");
+    set.add("ch3.mat4_mul_scalar", m, [&] {
+        for (size_t i = 0; i < m; ++i) C[i] = mul_scalar(A[i], B[i]);
+        doNotOptimize(C[m - 1]);
+    });
+    set.add("ch3.mat4_mul_simd", m, [&] {
+        for (size_t i = 0; i < m; ++i) C[i] = mul(A[i], B[i]);
+        doNotOptimize(C[m - 1]);
+    });
+    // CH3-2 방식: T, R, S 행렬을 각각 만들고 두 번 곱한다 (z축 회전)
+    set.add("ch3.compose_trs_matmul", m, [&] {
+        for (size_t i = 0; i < m; ++i) {
+            Mat4 T = mat4_identity(), R = mat4_identity(), S = mat4_identity();
+            T.m[12] = t[i].x; T.m[13] = t[i].y; T.m[14] = t[i].z;
+            const float c = std::cos(rad[i]), sn = std::sin(rad[i]);
+            R.m[0] = c; R.m[1] = sn; R.m[4] = -sn; R.m[5] = c;
+            S.m[0] = s[i].x; S.m[5] = s[i].y; S.m[10] = s[i].z;
+            C[i] = mul(T, mul(R, S));
+        }
+        doNotOptimize(C[m - 1]);
+    });
+    set.add("ch3.compose_trs_quat", m, [&] {
+        for (size_t i = 0; i < m; ++i) AC[i] = compose_trs(t[i], quat_from_axis_angle(axis[i], rad[i]), s[i]);
+        doNotOptimize(AC[m - 1]);
+    });
+    set.add("ch3.inverse_general", m, [&] {
+        for (size_t i = 0; i < m; ++i) inverse_general(A[i], C[i]);
+        doNotOptimize(C[m - 1]);
+    });
+    set.add("ch3.inverse_affine", m, [&] {
+        for (size_t i = 0; i < m; ++i) inverse_affine(AA[i], AC[i]);
+        doNotOptimize(AC[m - 1]);
+    });
+
+    const size_t np = 65536;
+    std::vector<float> px(np), py(np), pz(np), ox(np), oy(np), oz(np);
+    for (size_t i = 0; i < np; ++i) { px[i] = hash01((uint32_t)i * 3u); py[i] = hash01((uint32_t)i * 3u + 1u); pz[i] = hash01((uint32_t)i * 3u + 2u); }
+    set.add("ch3.transform_points_soa", np, [&] {
+        transformPointsSoA(A[0], px.data(), py.data(), pz.data(), ox.data(), oy.data(), oz.data(), px.size());
+        doNotOptimize(ox[np - 1]);
+    });
+    set.run(out);
+}
+
+// ------------------------------------------------------------
+// gl: headless 제출 경로
+// ------------------------------------------------------------
+
+static const char* kUniformVs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    uniform mat3 uM;
+    void main() {
+        vec3 tp = uM * vec3(aPos, 1.0);
+        gl_Position = vec4(tp.xy, 0.0, 1.0);
+    }
+)GLSL";
+
+// instance마다 mat3의 column 3개를 attribute로 받는다 (location 1..3, divisor 1)
+static const char* kInstancedVs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    layout (location = 1) in vec3 aM0;
+    layout (location = 2) in vec3 aM1;
+    layout (location = 3) in vec3 aM2;
+    void main() {
+        vec3 tp = mat3(aM0, aM1, aM2) * vec3(aPos, 1.0);
+        gl_Position = vec4(tp.xy, 0.0, 1.0);
+    }
+)GLSL";
+
+static const char* kOrangeFs = R"GLSL(
+    #version 330 core
+    out vec4 FragColor;
+    void main() {
+        FragColor = vec4(0.95, 0.65, 0.20, 1.0);
+    }
+)GLSL";
+
+static void benchGl(std::vector<BenchResult>& out, const BenchConfig& cfg) {
+    BenchSet set(cfg);
+    const int W = 512, H = 512;
+    const int draws = 1000;
+
+    RenderTarget rt = makeRenderTarget(W, H);
+    GLuint progUniform   = makeProgram(kUniformVs, kOrangeFs);
+    GLuint progInstanced = makeProgram(kInstancedVs, kOrangeFs);
+    const GLint locM = glGetUniformLocation(progUniform, "uM");
+
+    // CH3-2의 작은 triangle을 grid에 배치
+    std::vector<float> mats((size_t)draws * 9);
+    const int grid = (int)std::ceil(std::sqrt((double)draws));
+    for (int d = 0; d < draws; ++d) {
+        const float rad = hash01((uint32_t)d) * 6.2831853f;
+        const float c = std::cos(rad), s = std::sin(rad), sc = 1.5f / (float)grid;
+        const float tx = ((float)(d % grid) + 0.5f) / (float)grid * 2.0f - 1.0f;
+        const float ty = ((float)(d / grid) + 0.5f) / (float)grid * 2.0f - 1.0f;
+        const float m[9] = { c * sc, s * sc, 0.0f,  -s * sc, c * sc, 0.0f,  tx, ty, 1.0f };
+        std::memcpy(&mats[(size_t)d * 9], m, sizeof(m));
+    }
+
+    const float tri[] = { -0.5f, -0.5f,  0.5f, -0.5f,  0.0f, 0.5f };
+    GLuint vao = 0, vbo = 0, instVbo = 0;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &instVbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(tri), tri, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, instVbo);
+    glBufferData(GL_ARRAY_BUFFER, mats.size() * sizeof(float), nullptr, GL_STREAM_DRAW);
+    for (int c = 0; c < 3; ++c) {
+        glVertexAttribPointer(1 + c, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(c * 3 * sizeof(float)));
+        glEnableVertexAttribArray(1 + c);
+        glVertexAttribDivisor(1 + c, 1);
+    }
+    glBindVertexArray(0);
+
+    const size_t uploadBytes = (size_t)1 << 20;
+    std::vector<uint8_t> blob(uploadBytes, 0x5a);
+    GLuint uploadBuf = 0;
+    glGenBuffers(1, &uploadBuf);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, uploadBuf);
+    glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)uploadBytes, nullptr, GL_STREAM_DRAW);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+    glViewport(0, 0, W, H);
+    glClearColor(0.07f, 0.07f, 0.09f, 1.0f);
+
+    char title[96];
+    std::snprintf(title, sizeof(title), "[gl: headless submission, %dx%d, %d triangles/frame]", W, H, draws);
+    set.section(title);
+    set.add("gl.empty_frame", 1, [&] {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glFinish();
+    });
+    // CH3-2 render loop를 물체 수만큼: draw마다 glUniformMatrix3fv + glDrawArrays
+    set.add("gl.draw_per_object_uniform", (size_t)draws, [&] {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(progUniform);
+        glBindVertexArray(vao);
+        for (int d = 0; d < draws; ++d) {
+            glUniformMatrix3fv(locM, 1, GL_FALSE, &mats[(size_t)d * 9]);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        glFinish();
+    });
+    // 같은 장면: 행렬을 buffer 하나로 올리고 draw 1회
+    set.add("gl.draw_instanced", (size_t)draws, [&] {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(progInstanced);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, instVbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)(mats.size() * sizeof(float)), mats.data());
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 3, draws);
+        glFinish();
+    });
+    set.add("gl.buffer_upload_1mb", 1, [&] {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, uploadBuf);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)uploadBytes, blob.data());
+        glFinish();
+    });
+    set.run(out);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindVertexArray(0);
+    glDeleteBuffers(1, &uploadBuf);
+    glDeleteBuffers(1, &instVbo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(progUniform);
+    glDeleteProgram(progInstanced);
+    destroyRenderTarget(rt);
+}
+
+// ------------------------------------------------------------
+// JSON 저장 / baseline 비교
+// ------------------------------------------------------------
+
+static bool writeJson(const char* path, const char* renderer, const std::vector<BenchResult>& results) {
+    FILE* f = std::fopen(path, "w");
+    if (!f) {
+        std::fprintf(stderr, "cannot open '%s' for writing\n", path);
+        return false;
+    }
+    std::fprintf(f, "{\n  \"schema\": 1,\n  \"renderer\": \"%s\",\n  \"benchmarks\": [\n", renderer);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        std::fprintf(f, "    { \"name\": \"%s\", \"median_ns\": %.4f, \"min_ns\": %.4f, "
+                        "\"ops_per_run\": %zu, \"reps\": %d, \"samples\": %d }%s\n",
+                     r.name.c_str(), r.medianNs, r.minNs, r.opsPerRun, r.reps, r.samples,
+                     i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+    return true;
+}
+
+// writeJson이 쓴 형식만 읽는다: "name": "...", 그 뒤의 "median_ns": <number>, "min_ns": <number>
+static bool readBaseline(const char* path, std::vector<BenchResult>& out) {
+    FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        std::fprintf(stderr, "cannot open baseline '%s'\n", path);
+        return false;
+    }
+    std::string text;
+    char buf[4096];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) text.append(buf, n);
+    std::fclose(f);
+
+    size_t pos = 0;
+    while ((pos = text.find("\"name\"", pos)) != std::string::npos) {
+        const size_t q0 = text.find('"', text.find(':', pos) + 1);
+        const size_t q1 = text.find('"', q0 + 1);
+        const size_t md = text.find("\"median_ns\"", q1);
+        const size_t mn = text.find("\"min_ns\"", q1);
+        if (q0 == std::string::npos || q1 == std::string::npos || md == std::string::npos || mn == std::string::npos) break;
+
+        BenchResult r;
+        r.name     = text.substr(q0 + 1, q1 - q0 - 1);
+        r.medianNs = std::strtod(text.c_str() + text.find(':', md) + 1, nullptr);
+        r.minNs    = std::strtod(text.c_str() + text.find(':', mn) + 1, nullptr);
+        out.push_back(r);
+        pos = q1;
+    }
+    return true;
+}
+
+// 최소값끼리 비교한다. 다른 process에 밀린 시간은 측정을 늘리기만 하므로, 최소값이 중앙값보다 잡음에 덜 흔들린다.
+static int compareBaseline(const std::vector<BenchResult>& cur, const std::vector<BenchResult>& base, const BenchConfig& cfg) {
+    int regressions = 0;
+    std::printf("\n[baseline comparison (min ns/op), threshold cpu %.0f%%, gl %.0f%%]\n",
+                cfg.threshold * 100.0, cfg.glThreshold * 100.0);
+    for (const BenchResult& r : cur) {
+        const BenchResult* b = findResult(base, r.name);
+        if (!b || b->minNs <= 0.0) {
+            std::printf("  %-32s %12.3f ns/op  (no baseline)\n", r.name.c_str(), r.minNs);
+            continue;
+        }
+        const double threshold = r.name.rfind("gl.", 0) == 0 ? cfg.glThreshold : cfg.threshold;
+        const double ratio = r.minNs / b->minNs;
+        const char* tag = "";
+        // faster는 regression의 역수 기준: threshold가 1 이상이어도 의미가 있다 (1 - threshold는 0 이하가 된다)
+        if (ratio > 1.0 + threshold)              { tag = "  <-- REGRESSION"; ++regressions; }
+        else if (ratio < 1.0 / (1.0 + threshold)) { tag = "  (faster)"; }
+        std::printf("  %-32s %12.3f vs %12.3f ns/op  %+7.1f%%%s\n",
+                    r.name.c_str(), r.minNs, b->minNs, (ratio - 1.0) * 100.0, tag);
+    }
+    return regressions;
+}
+
+static void usage(const char* exe) {
+    std::fprintf(stderr,
+                 "usage: %s [--out results.json] [--baseline baseline.json] [--threshold 0.15] [--gl-threshold 0.3]\n"
+                 "          [--filter substring] [--samples N] [--sample-ms MS] [--no-gl]\n", exe);
+}
+
+int main(int argc, char** argv) {
+    BenchConfig cfg;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if      (!std::strcmp(a, "--out") && hasValue)          cfg.outPath     = argv[++i];
+        else if (!std::strcmp(a, "--baseline") && hasValue)     cfg.baseline    = argv[++i];
+        else if (!std::strcmp(a, "--threshold") && hasValue)    cfg.threshold   = std::atof(argv[++i]);
+        else if (!std::strcmp(a, "--gl-threshold") && hasValue) cfg.glThreshold = std::atof(argv[++i]);
+        else if (!std::strcmp(a, "--filter") && hasValue)       cfg.filter      = argv[++i];
+        else if (!std::strcmp(a, "--samples") && hasValue)      cfg.samples     = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(a, "--sample-ms") && hasValue)    cfg.sampleMs    = std::atof(argv[++i]);
+        else if (!std::strcmp(a, "--no-gl"))                    cfg.gl          = false;
+        else { usage(argv[0]); return 2; }
+    }
+
+    if (cfg.baseline && !readBaseline(cfg.baseline, cfg.base)) return 2;
+
+    std::vector<BenchResult> results;
+    benchMath(results, cfg);
+
+    std::string renderer = "none";
+    if (cfg.gl) {
+        HeadlessContext hc;
+        if (!createHeadlessContext(hc)) exit(1);
+        renderer = (const char*)glGetString(GL_RENDERER);
+        std::printf("GL_RENDERER = %s\n", renderer.c_str());
+        benchGl(results, cfg);
+        destroyHeadlessContext(hc);
+    }
+
+    if (cfg.outPath) {
+        if (!writeJson(cfg.outPath, renderer.c_str(), results)) return 2;
+        std::printf("\nresults written to %s\n", cfg.outPath);
+    }
+
+    if (cfg.baseline) {
+        const int regressions = compareBaseline(results, cfg.base, cfg);
+        if (regressions) {
+            std::fprintf(stderr, "%d benchmark(s) regressed beyond the threshold\n", regressions);
+            return 1;
+        }
+        std::printf("no regressions\n");
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+// src/mesh_normals.cpp
+// perf-4: indexed mesh 전체에 대한 batched geometry kernel
+//   - face normal / area / orientation + degeneracy flag (AVX2 gather + thread 분할)
+//   - area-weighted vertex normal (CSR 인접 목록 gather, 결정적 reduction)
+// CH2-3의 scalar sub/cross/normalize 결과와 비교 검증하고, 10M triangle 규모에서 처리량을 측정한다.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <cg101/mesh_kernels.hpp>
+#include <cg101/parallel.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+// 높이장 z = 0.3 sin(x) cos(y)를 가진 grid mesh. 일부 triangle은 winding을 뒤집고, 일부는 퇴화시킨다.
+struct Mesh {
+    std::vector<float>    pos; // xyz
+    std::vector<uint32_t> idx;
+    size_t vertexCount = 0;
+    size_t triCount    = 0;
+};
+
+static Mesh makeMesh(size_t targetTris) {
+    const size_t quads = targetTris / 2;
+    const int n = (int)std::ceil(std::sqrt((double)quads)) + 1;
+
+    Mesh m;
+    m.vertexCount = (size_t)n * n;
+    m.pos.resize(m.vertexCount * 3);
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const size_t v = (size_t)j * n + i;
+            const float x = (float)i * 0.05f;
+            const float y = (float)j * 0.05f;
+            m.pos[v * 3 + 0] = x;
+            m.pos[v * 3 + 1] = y;
+            m.pos[v * 3 + 2] = 0.3f * std::sin(x) * std::cos(y);
+        }
+    }
+
+    m.idx.reserve((size_t)(n - 1) * (n - 1) * 6);
+    for (int j = 0; j + 1 < n; ++j) {
+        for (int i = 0; i + 1 < n; ++i) {
+            const uint32_t a = (uint32_t)(j * n + i);
+            const uint32_t b = a + 1;
+            const uint32_t c = a + (uint32_t)n;
+            const uint32_t d = c + 1;
+            const size_t q = (size_t)j * (n - 1) + i;
+
+            if (q % 997 == 0)      m.idx.insert(m.idx.end(), { a, d, b, a, d, c }); // 첫 triangle CW
+            else if (q % 1009 == 0) m.idx.insert(m.idx.end(), { a, b, b, a, d, c }); // 첫 triangle 퇴화 (중복 꼭짓점)
+            else                    m.idx.insert(m.idx.end(), { a, b, d, a, d, c });
+        }
+    }
+    m.triCount = m.idx.size() / 3;
+    return m;
+}
+
+static void printRate(const char* label, size_t items, const char* unit, double ms) {
+    std::printf("  %-34s %9.2f ms  %8.1f M %s/s\n", label, ms, (double)items / (ms * 1e3), unit);
+}
+
+int main(int argc, char** argv) {
+    const size_t targetTris = (argc > 1) ? (size_t)std::atoll(argv[1]) : 10000000;
+
+    // ---- 0) CH2-3 예제 triangle: n = (0,0,1) ----
+    {
+        const float    p[9] = { 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f };
+        const uint32_t t[3] = { 0, 1, 2 };
+        FaceData fd;
+        computeFaces(p, t, 1, fd);
+        std::printf("CH2-3 triangle: nh = (%.3f, %.3f, %.3f), area = %.3f, flags = %u\n\n",
+                    fd.nx[0], fd.ny[0], fd.nz[0], fd.area[0], (unsigned)fd.flags[0]);
+    }
+
+    Mesh mesh = makeMesh(targetTris);
+    std::printf("mesh: %zu vertices, %zu triangles, threads = %u\n\n",
+                mesh.vertexCount, mesh.triCount, workerCount());
+
+    const float* pos = mesh.pos.data();
+    const uint32_t* idx = mesh.idx.data();
+    FaceParams prm;
+
+    // ---- 1) face kernel ----
+    std::printf("[face normal + area + flags]\n");
+    FaceData ref, simd1, simdN;
+    ref.resize(mesh.triCount);
+    simd1.resize(mesh.triCount);
+    simdN.resize(mesh.triCount); // 할당/첫 접근 비용을 측정에서 제외
+
+    Stopwatch sw;
+    computeFacesScalar(pos, idx, 0, mesh.triCount, prm, ref);
+    printRate("scalar (CH2-3 cross), 1 thread", mesh.triCount, "tri", sw.elapsed_ms());
+
+    sw.reset();
+    computeFacesSimd(pos, idx, 0, mesh.triCount, prm, simd1);
+    printRate("SIMD, 1 thread", mesh.triCount, "tri", sw.elapsed_ms());
+
+    sw.reset();
+    computeFaces(pos, idx, mesh.triCount, simdN, prm);
+    printRate("SIMD, all threads", mesh.triCount, "tri", sw.elapsed_ms());
+
+    // ---- 2) vertex normals ----
+    std::printf("\n[area-weighted vertex normals]\n");
+    std::vector<float> vnRef(mesh.vertexCount * 3), vn1(mesh.vertexCount * 3), vnN(mesh.vertexCount * 3);
+
+    sw.reset();
+    computeVertexNormalsScatter(simdN, idx, mesh.triCount, mesh.vertexCount, vnRef.data());
+    printRate("scatter (face order), 1 thread", mesh.vertexCount, "vtx", sw.elapsed_ms());
+
+    VertexAdjacency adj;
+    sw.reset();
+    buildVertexAdjacency(idx, mesh.triCount, mesh.vertexCount, adj);
+    printRate("build vertex->face CSR", mesh.vertexCount, "vtx", sw.elapsed_ms());
+
+    sw.reset();
+    computeVertexNormals(simdN, adj, mesh.vertexCount, vn1.data(), 1);
+    printRate("CSR gather, 1 thread", mesh.vertexCount, "vtx", sw.elapsed_ms());
+
+    // 결정성 확인을 위해 실제 core 수와 무관하게 여러 구간으로 나눠 실행
+    const unsigned manyThreads = std::max(workerCount(), 7u);
+    sw.reset();
+    computeVertexNormals(simdN, adj, mesh.vertexCount, vnN.data(), manyThreads);
+    char label[64];
+    std::snprintf(label, sizeof(label), "CSR gather, %u threads", manyThreads);
+    printRate(label, mesh.vertexCount, "vtx", sw.elapsed_ms());
+
+    // ---- 3) 검증 ----
+    size_t flagMismatch = 0;
+    float maxNormalErr = 0.0f, maxAreaRel = 0.0f;
+    size_t degenerate = 0, backFacing = 0;
+    for (size_t f = 0; f < mesh.triCount; ++f) {
+        // SIMD 1 thread / all threads 모두 scalar 기준과 비교한다
+        for (const FaceData* fd : { &simd1, &simdN }) {
+            flagMismatch += ref.flags[f] != fd->flags[f];
+            maxNormalErr = std::fmax(maxNormalErr, std::fabs(ref.nx[f] - fd->nx[f]));
+            maxNormalErr = std::fmax(maxNormalErr, std::fabs(ref.ny[f] - fd->ny[f]));
+            maxNormalErr = std::fmax(maxNormalErr, std::fabs(ref.nz[f] - fd->nz[f]));
+            if (ref.area[f] > 0.0f)
+                maxAreaRel = std::fmax(maxAreaRel, std::fabs(ref.area[f] - fd->area[f]) / ref.area[f]);
+        }
+        degenerate += (ref.flags[f] & kFaceDegenerate) != 0;
+        backFacing += (ref.flags[f] & kFaceBackFacing) != 0;
+    }
+
+    // face kernel은 triangle마다 독립이므로 thread 분할과 무관하게 bit 단위로 같아야 한다
+    auto sameBits = [](const auto& x, const auto& y) {
+        return x.size() == y.size() && std::memcmp(x.data(), y.data(), x.size() * sizeof(x[0])) == 0;
+    };
+    const bool facesDeterministic = sameBits(simd1.nx, simdN.nx) && sameBits(simd1.ny, simdN.ny) &&
+                                    sameBits(simd1.nz, simdN.nz) && sameBits(simd1.area, simdN.area) &&
+                                    sameBits(simd1.flags, simdN.flags);
+
+    float maxVertexErr = 0.0f;
+    for (size_t i = 0; i < vnRef.size(); ++i)
+        maxVertexErr = std::fmax(maxVertexErr, std::fabs(vnRef[i] - vnN[i]));
+    const bool deterministic = std::memcmp(vn1.data(), vnN.data(), vn1.size() * sizeof(float)) == 0;
+
+    std::printf("\n[verify vs scalar]\n");
+    std::printf("  flags: %zu degenerate, %zu back-facing, %zu mismatches\n", degenerate, backFacing, flagMismatch);
+    std::printf("  face normal max |err| = %.2e, area max rel err = %.2e\n", maxNormalErr, maxAreaRel);
+    std::printf("  face data bitwise identical for SIMD 1 thread vs all threads: %s\n",
+                facesDeterministic ? "yes" : "NO");
+    std::printf("  vertex normal max |err| vs scatter = %.2e\n", maxVertexErr);
+    std::printf("  vertex normals bitwise identical for 1 vs %u threads: %s\n",
+                manyThreads, deterministic ? "yes" : "NO");
+
+    const bool ok = flagMismatch == 0 && maxNormalErr <= 1e-5f && maxAreaRel <= 1e-5f && facesDeterministic &&
+                    maxVertexErr <= 1e-5f && deterministic;
+    if (!ok) {
+        std::fprintf(stderr, "mesh kernel results differ from scalar reference!\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,360 @@
+// src/particles.cpp
+// perf-2: 2D particle simulation
+//   - CPU: SoA + SIMD(AVX/SSE) + thread 분할
+//   - GPU: transform feedback ping-pong (vertex shader가 integrator, 결과를 다른 VBO에 기록)
+// 두 경로의 particles/second를 측정하고, point sprite로 렌더까지 포함한 frame 시간을 비교한다.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_util.hpp>
+#include <cg101/particles.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+// GPU 상태 VBO의 정점 하나: pos(2) + vel(2) + life(1), transform feedback이 그대로 이 순서로 기록한다
+static constexpr GLsizei kStateFloats = 5;
+
+struct GpuParticles {
+    GLuint state[2]   = { 0, 0 }; // ping-pong
+    GLuint vao[2]     = { 0, 0 }; // vao[i]: state[i] + spawn을 읽는다
+    GLuint spawn      = 0;        // respawn velocity (고정)
+    GLuint program    = 0;
+    int    cur        = 0;
+    size_t count      = 0;
+
+    GLint locDt = -1, locRot = -1, locGdt = -1, locDamping = -1, locEmit = -1, locLifetime = -1;
+};
+
+static GpuParticles createGpuParticles(const ParticleSoA& p) {
+    const char* vsSrc = R"GLSL(
+        #version 330 core
+        layout (location = 0) in vec2  aPos;
+        layout (location = 1) in vec2  aVel;
+        layout (location = 2) in float aLife;
+        layout (location = 3) in vec2  aSpawnVel;
+
+        uniform float uDt;
+        uniform vec2  uRot;      // (cos(omega*dt), sin(omega*dt))
+        uniform vec2  uGdt;      // gravity * dt
+        uniform float uDamping;
+        uniform vec2  uEmit;
+        uniform float uLifetime;
+
+        out vec2  oPos;
+        out vec2  oVel;
+        out float oLife;
+
+        void main() {
+            vec2 v = vec2(aVel.x * uRot.x - aVel.y * uRot.y,
+                          aVel.x * uRot.y + aVel.y * uRot.x);
+            v = (v + uGdt) * uDamping;
+            vec2 p = aPos + v * uDt;
+            float life = aLife - uDt;
+
+            if (life <= 0.0) {
+                p = uEmit;
+                v = aSpawnVel;
+                life += uLifetime;
+            }
+
+            oPos = p;
+            oVel = v;
+            oLife = life;
+        }
+    )GLSL";
+
+    GpuParticles g;
+    g.count = p.size();
+
+    // fragment shader 없이 vertex shader만으로 program 구성 (rasterizer discard 상태에서만 사용)
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vsSrc);
+    g.program = glCreateProgram();
+    glAttachShader(g.program, vs);
+    const char* varyings[] = { "oPos", "oVel", "oLife" };
+    glTransformFeedbackVaryings(g.program, 3, varyings, GL_INTERLEAVED_ATTRIBS);
+    linkProgram(g.program);
+    glDeleteShader(vs);
+
+    g.locDt       = glGetUniformLocation(g.program, "uDt");
+    g.locRot      = glGetUniformLocation(g.program, "uRot");
+    g.locGdt      = glGetUniformLocation(g.program, "uGdt");
+    g.locDamping  = glGetUniformLocation(g.program, "uDamping");
+    g.locEmit     = glGetUniformLocation(g.program, "uEmit");
+    g.locLifetime = glGetUniformLocation(g.program, "uLifetime");
+
+    // SoA -> GPU interleaved 초기 상태
+    std::vector<float> init(p.size() * kStateFloats);
+    std::vector<float> spawn(p.size() * 2);
+    for (size_t i = 0; i < p.size(); ++i) {
+        float* s = &init[i * kStateFloats];
+        s[0] = p.px[i]; s[1] = p.py[i];
+        s[2] = p.vx[i]; s[3] = p.vy[i];
+        s[4] = p.life[i];
+        spawn[i * 2 + 0] = p.svx[i];
+        spawn[i * 2 + 1] = p.svy[i];
+    }
+
+    glGenBuffers(2, g.state);
+    glGenBuffers(1, &g.spawn);
+    glGenVertexArrays(2, g.vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, g.spawn);
+    glBufferData(GL_ARRAY_BUFFER, spawn.size() * sizeof(float), spawn.data(), GL_STATIC_DRAW);
+
+    const GLsizei stride = kStateFloats * sizeof(float);
+    for (int i = 0; i < 2; ++i) {
+        glBindBuffer(GL_ARRAY_BUFFER, g.state[i]);
+        glBufferData(GL_ARRAY_BUFFER, init.size() * sizeof(float), init.data(), GL_DYNAMIC_COPY);
+
+        glBindVertexArray(g.vao[i]);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(2);
+
+        glBindBuffer(GL_ARRAY_BUFFER, g.spawn);
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(3);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return g;
+}
+
+// state[cur] -> (vertex shader) -> state[1-cur], 이후 cur 교체
+static void stepGpuParticles(GpuParticles& g, const ParticleParams& prm) {
+    glUseProgram(g.program);
+    glUniform1f(g.locDt, prm.dt);
+    glUniform2f(g.locRot, std::cos(prm.omega * prm.dt), std::sin(prm.omega * prm.dt));
+    glUniform2f(g.locGdt, prm.gx * prm.dt, prm.gy * prm.dt);
+    glUniform1f(g.locDamping, prm.damping);
+    glUniform2f(g.locEmit, prm.emitX, prm.emitY);
+    glUniform1f(g.locLifetime, prm.lifetime);
+
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(g.vao[g.cur]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, g.state[1 - g.cur]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, (GLsizei)g.count);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glBindVertexArray(0);
+    glDisable(GL_RASTERIZER_DISCARD);
+
+    g.cur = 1 - g.cur;
+}
+
+static void destroyGpuParticles(GpuParticles& g) {
+    glDeleteVertexArrays(2, g.vao);
+    glDeleteBuffers(2, g.state);
+    glDeleteBuffers(1, &g.spawn);
+    glDeleteProgram(g.program);
+    g = {};
+}
+
+// 두 상태의 position 최대 차이 (GPU 상태는 interleaved)
+static float maxPosDiff(const ParticleSoA& a, const ParticleSoA& b) {
+    float m = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        m = std::fmax(m, std::fabs(a.px[i] - b.px[i]));
+        m = std::fmax(m, std::fabs(a.py[i] - b.py[i]));
+    }
+    return m;
+}
+
+static float maxPosDiff(const ParticleSoA& a, const std::vector<float>& gpu) {
+    float m = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        m = std::fmax(m, std::fabs(a.px[i] - gpu[i * kStateFloats + 0]));
+        m = std::fmax(m, std::fabs(a.py[i] - gpu[i * kStateFloats + 1]));
+    }
+    return m;
+}
+
+static void printRate(const char* label, size_t n, int steps, double ms) {
+    const double perStep = ms / steps;
+    std::printf("  %-28s %9.3f ms/step  %8.1f M particles/s\n",
+                label, perStep, (double)n / (perStep * 1e3));
+}
+
+int main(int argc, char** argv) {
+    const size_t count = (argc > 1) ? (size_t)std::atoll(argv[1]) : 1000000;
+    const int    steps = (argc > 2) ? std::atoi(argv[2]) : 10;
+    const int W = 1024, H = 1024;
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+    std::printf("particles = %zu, steps = %d, threads = %u\n\n", count, steps, workerCount());
+
+    ParticleParams prm;
+    ParticleSoA initial;
+    initParticles(initial, count, prm);
+
+    // ---- 1) simulation only ----
+    std::printf("[simulation]\n");
+
+    ParticleSoA ref = initial;
+    Stopwatch sw;
+    for (int s = 0; s < steps; ++s) integrateScalar(ref, 0, ref.size(), prm);
+    printRate("CPU scalar, 1 thread", count, steps, sw.elapsed_ms());
+
+    ParticleSoA simd1 = initial;
+    sw.reset();
+    for (int s = 0; s < steps; ++s) integrateSimd(simd1, 0, simd1.size(), prm);
+    printRate("CPU SIMD, 1 thread", count, steps, sw.elapsed_ms());
+
+    ParticleSoA simdN = initial;
+    sw.reset();
+    for (int s = 0; s < steps; ++s) integrateParallel(simdN, prm);
+    printRate("CPU SIMD, all threads", count, steps, sw.elapsed_ms());
+
+    GpuParticles gpu = createGpuParticles(initial);
+    stepGpuParticles(gpu, prm); // warm-up: shader compile/driver 준비 (상태는 아래에서 다시 올린다)
+    glFinish();
+    destroyGpuParticles(gpu);
+    gpu = createGpuParticles(initial);
+    glFinish();
+
+    sw.reset();
+    for (int s = 0; s < steps; ++s) stepGpuParticles(gpu, prm);
+    glFinish();
+    printRate("GPU transform feedback", count, steps, sw.elapsed_ms());
+
+    // ---- 2) 검증: 모든 경로가 같은 규칙을 계산했는지 ----
+    std::vector<float> gpuState(count * kStateFloats);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.state[gpu.cur]);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, gpuState.size() * sizeof(float), gpuState.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    const float tol = 1e-3f;
+    const float dSimd1 = maxPosDiff(ref, simd1);
+    const float dSimdN = maxPosDiff(ref, simdN);
+    const float dGpu   = maxPosDiff(ref, gpuState);
+    std::printf("\n[verify] max |pos - scalar|: SIMD 1T = %.2e, SIMD MT = %.2e, GPU = %.2e (tol %.0e)\n\n",
+                dSimd1, dSimdN, dGpu, tol);
+    const bool ok = dSimd1 <= tol && dSimdN <= tol && dGpu <= tol;
+
+    // ---- 3) simulation + point sprite 렌더 ----
+    const char* fsSrc = R"GLSL(
+        #version 330 core
+        in float vFade;
+        out vec4 FragColor;
+        void main() {
+            FragColor = vec4(vec3(1.0, 0.55, 0.2) * vFade * 0.25, 1.0);
+        }
+    )GLSL";
+
+    // CPU 경로: SoA 배열(px, py, life)을 한 VBO의 세 구간으로 그대로 올리고 float attribute 3개로 읽는다
+    const char* vsCpuSrc = R"GLSL(
+        #version 330 core
+        layout (location = 0) in float aX;
+        layout (location = 1) in float aY;
+        layout (location = 2) in float aLife;
+        uniform float uLifetime;
+        out float vFade;
+        void main() {
+            vFade = clamp(aLife / uLifetime, 0.0, 1.0);
+            gl_Position = vec4(aX, aY, 0.0, 1.0);
+            gl_PointSize = 1.0;
+        }
+    )GLSL";
+
+    // GPU 경로: transform feedback 결과 VBO를 그대로 렌더 입력으로 사용 (CPU 왕복 없음)
+    const char* vsGpuSrc = R"GLSL(
+        #version 330 core
+        layout (location = 0) in vec2  aPos;
+        layout (location = 2) in float aLife;
+        uniform float uLifetime;
+        out float vFade;
+        void main() {
+            vFade = clamp(aLife / uLifetime, 0.0, 1.0);
+            gl_Position = vec4(aPos, 0.0, 1.0);
+            gl_PointSize = 1.0;
+        }
+    )GLSL";
+
+    GLuint progCpu = makeProgram(vsCpuSrc, fsSrc);
+    GLuint progGpu = makeProgram(vsGpuSrc, fsSrc);
+
+    GLuint cpuVao = 0, cpuVbo = 0;
+    const GLsizeiptr arrBytes = (GLsizeiptr)(count * sizeof(float));
+    glGenVertexArrays(1, &cpuVao);
+    glGenBuffers(1, &cpuVbo);
+    glBindVertexArray(cpuVao);
+    glBindBuffer(GL_ARRAY_BUFFER, cpuVbo);
+    glBufferData(GL_ARRAY_BUFFER, 3 * arrBytes, nullptr, GL_STREAM_DRAW);
+    glVertexAttribPointer(0, 1, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, 0, (void*)(arrBytes));
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 0, (void*)(2 * arrBytes));
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    glBindVertexArray(0);
+
+    RenderTarget rt = makeRenderTarget(W, H);
+    glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+    glViewport(0, 0, W, H);
+    glEnable(GL_PROGRAM_POINT_SIZE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE); // additive
+
+    std::printf("[simulation + render, %dx%d point sprites]\n", W, H);
+
+    sw.reset();
+    for (int s = 0; s < steps; ++s) {
+        integrateParallel(simdN, prm);
+
+        // orphaning: 이전 frame이 아직 읽는 중이어도 driver가 새 storage를 주므로 stall이 없다
+        glBindBuffer(GL_ARRAY_BUFFER, cpuVbo);
+        glBufferData(GL_ARRAY_BUFFER, 3 * arrBytes, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0,            arrBytes, simdN.px.data());
+        glBufferSubData(GL_ARRAY_BUFFER, arrBytes,     arrBytes, simdN.py.data());
+        glBufferSubData(GL_ARRAY_BUFFER, 2 * arrBytes, arrBytes, simdN.life.data());
+
+        glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(progCpu);
+        glUniform1f(glGetUniformLocation(progCpu, "uLifetime"), prm.lifetime);
+        glBindVertexArray(cpuVao);
+        glDrawArrays(GL_POINTS, 0, (GLsizei)count);
+    }
+    glFinish();
+    printRate("CPU SIMD MT + upload + draw", count, steps, sw.elapsed_ms());
+
+    sw.reset();
+    for (int s = 0; s < steps; ++s) {
+        stepGpuParticles(gpu, prm);
+
+        glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(progGpu);
+        glUniform1f(glGetUniformLocation(progGpu, "uLifetime"), prm.lifetime);
+        glBindVertexArray(gpu.vao[gpu.cur]);
+        glDrawArrays(GL_POINTS, 0, (GLsizei)count);
+    }
+    glFinish();
+    printRate("GPU transform feedback + draw", count, steps, sw.elapsed_ms());
+
+    glBindVertexArray(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    destroyRenderTarget(rt);
+    glDeleteVertexArrays(1, &cpuVao);
+    glDeleteBuffers(1, &cpuVbo);
+    glDeleteProgram(progCpu);
+    glDeleteProgram(progGpu);
+    destroyGpuParticles(gpu);
+    destroyHeadlessContext(hc);
+
+    if (!ok) {
+        std::fprintf(stderr, "particle integrators disagree!\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,456 @@
+// src/postfx_graph.cpp
+// perf-6: render graph로 구성한 multi-pass post-processing chain
+//   scene(HDR) -> bright -> bloom 3단계(blur H/V + downsample) -> composite(+HUD) -> AA -> grade -> present (+overlay)
+// 같은 graph를 두 가지 설정으로 compile해 비교한다.
+//   - naive    : cull/reorder/aliasing 없음, pass마다 bind -> draw -> bind(0)
+//   - compiled : 미사용 pass 제거, 같은 target pass 연속 배치, transient texture aliasing, 중복 bind 생략
+// transient texture 메모리(peak), glBindFramebuffer 호출 수, frame 시간을 출력하고 두 결과 이미지가 같은지 검증한다.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_util.hpp>
+#include <cg101/render_graph.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+// 정점 buffer 없이 gl_VertexID로 화면 전체를 덮는 triangle 하나
+static const char* kFullscreenVs = R"GLSL(
+    #version 330 core
+    out vec2 vUv;
+    void main() {
+        vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+        vUv = p;
+        gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);
+    }
+)GLSL";
+
+// CH1 triangle을 instance마다 다른 위치/색/밝기로 그린다. 밝기 > 1인 부분이 bloom의 원천이 된다.
+static const char* kSceneVs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    uniform float uScale;
+    out vec3 vColor;
+
+    float hash(float n) { return fract(sin(n) * 43758.5453); }
+
+    void main() {
+        float id = float(gl_InstanceID);
+        vec2 center = vec2(hash(id * 1.7), hash(id * 3.1)) * 2.0 - 1.0;
+        float a = hash(id * 5.3) * 6.2831853;
+        mat2 R = mat2(cos(a), sin(a), -sin(a), cos(a));
+        gl_Position = vec4(center + R * aPos * uScale, 0.0, 1.0);
+        vColor = vec3(hash(id * 7.7), hash(id * 9.1), hash(id * 11.3)) * (0.5 + 3.5 * hash(id * 13.9));
+    }
+)GLSL";
+
+static const char* kSceneFs = R"GLSL(
+    #version 330 core
+    in vec3 vColor;
+    out vec4 FragColor;
+    void main() { FragColor = vec4(vColor, 1.0); }
+)GLSL";
+
+static const char* kBrightFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    out vec4 FragColor;
+    void main() { FragColor = vec4(max(texture(uTex0, vUv).rgb - 1.0, 0.0), 1.0); }
+)GLSL";
+
+// 9-tap gaussian (uDir = 한 texel 만큼의 uv 이동)
+static const char* kBlurFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    uniform vec2 uDir;
+    out vec4 FragColor;
+    void main() {
+        const float w[5] = float[](0.2270270, 0.1945946, 0.1216216, 0.0540541, 0.0162162);
+        vec3 c = texture(uTex0, vUv).rgb * w[0];
+        for (int i = 1; i < 5; ++i) {
+            c += texture(uTex0, vUv + uDir * float(i)).rgb * w[i];
+            c += texture(uTex0, vUv - uDir * float(i)).rgb * w[i];
+        }
+        FragColor = vec4(c, 1.0);
+    }
+)GLSL";
+
+// target이 source의 절반 크기이므로 bilinear 한 번이 2x2 평균이다
+static const char* kCopyFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    out vec4 FragColor;
+    void main() { FragColor = vec4(texture(uTex0, vUv).rgb, 1.0); }
+)GLSL";
+
+static const char* kHudBgFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    out vec4 FragColor;
+    void main() {
+        float bar = step(vUv.y, 0.08) + step(0.95, vUv.y);
+        FragColor = vec4(0.05, 0.05, 0.08, 0.7) * bar;
+    }
+)GLSL";
+
+static const char* kHudIconFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    out vec4 FragColor;
+    void main() {
+        vec2 cell = fract(vUv * vec2(16.0, 1.0 / 0.08));
+        float icon = step(vUv.y, 0.08) * step(length(cell - 0.5), 0.3);
+        FragColor = vec4(0.9, 0.8, 0.2, 1.0) * icon;
+    }
+)GLSL";
+
+// HDR + bloom 3단계 + HUD(premultiplied alpha) -> Reinhard tonemap
+static const char* kCompositeFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0; // hdr
+    uniform sampler2D uTex1; // bloom 1/2
+    uniform sampler2D uTex2; // bloom 1/4
+    uniform sampler2D uTex3; // bloom 1/8
+    uniform sampler2D uTex4; // hud
+    out vec4 FragColor;
+    void main() {
+        vec3 c = texture(uTex0, vUv).rgb
+               + texture(uTex1, vUv).rgb * 0.6
+               + texture(uTex2, vUv).rgb * 0.3
+               + texture(uTex3, vUv).rgb * 0.2;
+        c = c / (1.0 + c);
+        vec4 hud = texture(uTex4, vUv);
+        FragColor = vec4(c * (1.0 - hud.a) + hud.rgb, 1.0);
+    }
+)GLSL";
+
+// 밝기 차이가 큰 곳만 주변 4 texel과 섞는 간단한 edge smoothing
+static const char* kAaFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    uniform vec2 uTexel;
+    out vec4 FragColor;
+    float luma(vec3 c) { return dot(c, vec3(0.299, 0.587, 0.114)); }
+    void main() {
+        vec3 c = texture(uTex0, vUv).rgb;
+        vec3 n = texture(uTex0, vUv + vec2(0.0, uTexel.y)).rgb;
+        vec3 s = texture(uTex0, vUv - vec2(0.0, uTexel.y)).rgb;
+        vec3 e = texture(uTex0, vUv + vec2(uTexel.x, 0.0)).rgb;
+        vec3 w = texture(uTex0, vUv - vec2(uTexel.x, 0.0)).rgb;
+        float lc = luma(c);
+        float contrast = max(max(abs(luma(n) - lc), abs(luma(s) - lc)), max(abs(luma(e) - lc), abs(luma(w) - lc)));
+        vec3 blur = (c * 4.0 + n + s + e + w) / 8.0;
+        FragColor = vec4(mix(c, blur, smoothstep(0.05, 0.2, contrast)), 1.0);
+    }
+)GLSL";
+
+static const char* kGradeFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    out vec4 FragColor;
+    void main() {
+        vec3 c = texture(uTex0, vUv).rgb;
+        float v = 1.0 - 0.6 * dot(vUv - 0.5, vUv - 0.5);
+        c = pow(c * v, vec3(0.95)) * vec3(1.02, 1.0, 0.97);
+        FragColor = vec4(c, 1.0);
+    }
+)GLSL";
+
+// 결과를 아무도 읽지 않는 디버그 시각화 (cull 대상)
+static const char* kLumaDebugFs = R"GLSL(
+    #version 330 core
+    in vec2 vUv;
+    uniform sampler2D uTex0;
+    out vec4 FragColor;
+    void main() {
+        float l = dot(texture(uTex0, vUv).rgb, vec3(0.2126, 0.7152, 0.0722));
+        FragColor = vec4(vec3(log2(1.0 + l) * 0.25), 1.0);
+    }
+)GLSL";
+
+struct Programs {
+    GLuint scene = 0, bright = 0, blur = 0, copy = 0, hudBg = 0, hudIcon = 0;
+    GLuint composite = 0, aa = 0, grade = 0, lumaDebug = 0;
+    GLuint emptyVao = 0, triVao = 0, triVbo = 0;
+};
+
+static GLuint makePostProgram(const char* fs) {
+    GLuint prog = makeProgram(kFullscreenVs, fs);
+    glUseProgram(prog);
+    const char* names[] = { "uTex0", "uTex1", "uTex2", "uTex3", "uTex4" };
+    for (int i = 0; i < 5; ++i) {
+        GLint loc = glGetUniformLocation(prog, names[i]);
+        if (loc >= 0) glUniform1i(loc, i);
+    }
+    glUseProgram(0);
+    return prog;
+}
+
+static Programs createPrograms() {
+    Programs p;
+    p.scene     = makeProgram(kSceneVs, kSceneFs);
+    p.bright    = makePostProgram(kBrightFs);
+    p.blur      = makePostProgram(kBlurFs);
+    p.copy      = makePostProgram(kCopyFs);
+    p.hudBg     = makePostProgram(kHudBgFs);
+    p.hudIcon   = makePostProgram(kHudIconFs);
+    p.composite = makePostProgram(kCompositeFs);
+    p.aa        = makePostProgram(kAaFs);
+    p.grade     = makePostProgram(kGradeFs);
+    p.lumaDebug = makePostProgram(kLumaDebugFs);
+
+    // core profile은 VAO 없이 draw할 수 없으므로 fullscreen pass용 빈 VAO
+    glGenVertexArrays(1, &p.emptyVao);
+
+    // CH1 triangle
+    const float tri[] = { -0.5f, -0.5f,  0.5f, -0.5f,  0.0f, 0.5f };
+    glGenVertexArrays(1, &p.triVao);
+    glGenBuffers(1, &p.triVbo);
+    glBindVertexArray(p.triVao);
+    glBindBuffer(GL_ARRAY_BUFFER, p.triVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(tri), tri, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+    return p;
+}
+
+static void destroyPrograms(Programs& p) {
+    for (GLuint prog : { p.scene, p.bright, p.blur, p.copy, p.hudBg, p.hudIcon,
+                         p.composite, p.aa, p.grade, p.lumaDebug })
+        glDeleteProgram(prog);
+    glDeleteVertexArrays(1, &p.emptyVao);
+    glDeleteVertexArrays(1, &p.triVao);
+    glDeleteBuffers(1, &p.triVbo);
+    p = {};
+}
+
+// reads 순서대로 texture unit 0, 1, 2, ...에 bind하고 fullscreen triangle을 그린다
+static void drawFullscreen(const Programs& P, GLuint prog, const PassContext& ctx,
+                           const std::vector<ResourceId>& reads) {
+    glUseProgram(prog);
+    for (size_t i = 0; i < reads.size(); ++i) {
+        glActiveTexture(GL_TEXTURE0 + (GLenum)i);
+        glBindTexture(GL_TEXTURE_2D, ctx.texture(reads[i]));
+    }
+    glBindVertexArray(P.emptyVao);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+// 한 frame의 post-processing chain 선언. 선언 순서는 "읽기 쉬운 순서"이며, 실행 순서는 graph가 정한다.
+static void buildPostChain(RenderGraph& g, const Programs& P, const RenderTarget& output, int instances) {
+    const int W = output.w, H = output.h;
+    const ResourceId out      = g.importTarget("output", output);
+    const ResourceId hdr      = g.createTexture("hdr",       { W, H, GL_RGBA16F });
+    const ResourceId hud      = g.createTexture("hud",       { W, H, GL_RGBA8 });
+    const ResourceId ldr      = g.createTexture("ldr",       { W, H, GL_RGBA8 });
+    const ResourceId aa       = g.createTexture("aa",        { W, H, GL_RGBA8 });
+    const ResourceId graded   = g.createTexture("graded",    { W, H, GL_RGBA8 });
+    const ResourceId lumaDbg  = g.createTexture("luma_debug", { W, H, GL_RGBA8 });
+    g.markOutput(out);
+
+    auto fullscreen = [&P](GLuint prog, std::vector<ResourceId> reads) {
+        return [&P, prog, reads](const PassContext& ctx) { drawFullscreen(P, prog, ctx, reads); };
+    };
+
+    // HUD 배경: 화면 맨 위/아래 bar (premultiplied alpha)
+    g.addPass({ "hud_background", {}, hud, false, false, fullscreen(P.hudBg, {}) });
+
+    g.addPass({ "scene", {}, hdr, false, false, [&P, instances](const PassContext&) {
+        glClearColor(0.02f, 0.02f, 0.03f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(P.scene);
+        glUniform1f(glGetUniformLocation(P.scene, "uScale"), 0.12f);
+        glBindVertexArray(P.triVao);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 3, instances);
+    } });
+
+    // bloom: 1/2, 1/4, 1/8 해상도에서 각각 blur H -> blur V
+    ResourceId prev = hdr;
+    ResourceId bloom[3];
+    for (int level = 0; level < 3; ++level) {
+        const int lw = W >> (level + 1), lh = H >> (level + 1);
+        char name[32];
+        std::snprintf(name, sizeof(name), "bloom%d_in", level);
+        const ResourceId in = g.createTexture(name, { lw, lh, GL_RGBA16F });
+        std::snprintf(name, sizeof(name), "bloom%d_h", level);
+        const ResourceId h = g.createTexture(name, { lw, lh, GL_RGBA16F });
+        std::snprintf(name, sizeof(name), "bloom%d_v", level);
+        const ResourceId v = g.createTexture(name, { lw, lh, GL_RGBA16F });
+
+        g.addPass({ level == 0 ? "bright" : (level == 1 ? "down1" : "down2"), { prev }, in, false, false,
+                    fullscreen(level == 0 ? P.bright : P.copy, { prev }) });
+
+        const float tx = 1.0f / (float)lw, ty = 1.0f / (float)lh;
+        for (int axis = 0; axis < 2; ++axis) {
+            const ResourceId src = axis == 0 ? in : h;
+            const ResourceId dst = axis == 0 ? h : v;
+            const float dx = axis == 0 ? tx : 0.0f, dy = axis == 0 ? 0.0f : ty;
+            std::snprintf(name, sizeof(name), "blur%d_%c", level, axis == 0 ? 'h' : 'v');
+            g.addPass({ name, { src }, dst, false, false, [&P, src, dx, dy](const PassContext& ctx) {
+                glUseProgram(P.blur);
+                glUniform2f(glGetUniformLocation(P.blur, "uDir"), dx, dy);
+                drawFullscreen(P, P.blur, ctx, { src });
+            } });
+        }
+
+        // HUD icon은 bloom 선언 사이에 끼어 있지만 hud_background와 같은 target이다 (reorder로 이어 붙는다)
+        if (level == 0) {
+            g.addPass({ "hud_icons", {}, hud, true, false, [&P](const PassContext& ctx) {
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                drawFullscreen(P, P.hudIcon, ctx, {});
+                glDisable(GL_BLEND);
+            } });
+        }
+
+        bloom[level] = v;
+        prev = v;
+    }
+
+    g.addPass({ "luma_debug", { hdr }, lumaDbg, false, false, fullscreen(P.lumaDebug, { hdr }) });
+
+    g.addPass({ "composite", { hdr, bloom[0], bloom[1], bloom[2], hud }, ldr, false, false,
+                fullscreen(P.composite, { hdr, bloom[0], bloom[1], bloom[2], hud }) });
+
+    g.addPass({ "aa", { ldr }, aa, false, false, [&P, ldr, W, H](const PassContext& ctx) {
+        glUseProgram(P.aa);
+        glUniform2f(glGetUniformLocation(P.aa, "uTexel"), 1.0f / (float)W, 1.0f / (float)H);
+        drawFullscreen(P, P.aa, ctx, { ldr });
+    } });
+
+    g.addPass({ "grade", { aa }, graded, false, false, fullscreen(P.grade, { aa }) });
+    g.addPass({ "present", { graded }, out, false, false, fullscreen(P.copy, { graded }) });
+
+    // 최종 출력 위에 CH1 triangle 하나를 반투명으로 얹는다 (같은 target, keepContents)
+    g.addPass({ "overlay", {}, out, true, false, [&P](const PassContext&) {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glUseProgram(P.scene);
+        glUniform1f(glGetUniformLocation(P.scene, "uScale"), 0.3f);
+        glBindVertexArray(P.triVao);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 1);
+        glDisable(GL_BLEND);
+    } });
+}
+
+static void printSchedule(const RenderGraph& g) {
+    std::printf("  order:");
+    for (int p : g.order()) std::printf(" %s", g.pass(p).name.c_str());
+    std::printf("\n  transient -> physical [first, last]:\n");
+    for (size_t r = 0; r < g.resourceCount(); ++r) {
+        const int phys = g.physicalOf((ResourceId)r);
+        if (phys < 0) continue;
+        std::printf("    %-12s -> #%d [%2d, %2d]\n", g.resourceName((ResourceId)r), phys,
+                    g.firstUse((ResourceId)r), g.lastUse((ResourceId)r));
+    }
+}
+
+static void printStats(const char* label, const RenderGraphStats& s, double msPerFrame) {
+    std::printf("  %-9s passes %2d (culled %d), textures %2d -> %2d, memory %7.2f MB -> %7.2f MB, "
+                "FBO binds/frame %2d (target changes %2d), %8.2f ms/frame\n",
+                label, s.passes - s.culledPasses, s.culledPasses, s.transientTextures, s.physicalTextures,
+                (double)s.transientBytes / (1024.0 * 1024.0), (double)s.physicalBytes / (1024.0 * 1024.0),
+                s.fboBinds, s.targetChanges, msPerFrame);
+}
+
+static double runFrames(RenderGraph& g, int frames) {
+    g.execute(); // warm-up: shader 준비, texture 첫 접근
+    glFinish();
+    Stopwatch sw;
+    for (int f = 0; f < frames; ++f) g.execute();
+    glFinish();
+    return sw.elapsed_ms() / frames;
+}
+
+int main(int argc, char** argv) {
+    const int W      = (argc > 1) ? std::atoi(argv[1]) : 1280;
+    const int H      = (argc > 2) ? std::atoi(argv[2]) : 720;
+    const int frames = (argc > 3) ? std::atoi(argv[3]) : 10;
+    const int instances = 2000;
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+    std::printf("output = %dx%d, frames = %d\n\n", W, H, frames);
+
+    Programs P = createPrograms();
+    RenderTarget outNaive    = makeRenderTarget(W, H);
+    RenderTarget outInOrder  = makeRenderTarget(W, H);
+    RenderTarget outCompiled = makeRenderTarget(W, H);
+
+    RenderGraph naive, inOrder, compiled;
+    buildPostChain(naive, P, outNaive, instances);
+    buildPostChain(inOrder, P, outInOrder, instances);
+    buildPostChain(compiled, P, outCompiled, instances);
+
+    // naive: CH1 방식 그대로. in-order: reorder만 끈 기본 설정 (선언 순서, 재바인딩 생략) -> bind 비교의 기준
+    RenderGraphOptions naiveOpt;
+    naiveOpt.cull = naiveOpt.reorder = naiveOpt.alias = naiveOpt.elideRebinds = false;
+    RenderGraphOptions inOrderOpt;
+    inOrderOpt.reorder = false;
+    if (!naive.compile(naiveOpt) || !inOrder.compile(inOrderOpt) || !compiled.compile()) exit(1);
+
+    std::printf("[compiled schedule]\n");
+    printSchedule(compiled);
+
+    const double msNaive    = runFrames(naive, frames);
+    const double msInOrder  = runFrames(inOrder, frames);
+    const double msCompiled = runFrames(compiled, frames);
+
+    std::printf("\n[naive vs in-order vs compiled]\n");
+    printStats("naive", naive.stats(), msNaive);
+    printStats("in-order", inOrder.stats(), msInOrder);
+    printStats("compiled", compiled.stats(), msCompiled);
+
+    // ---- 검증: cull/reorder/aliasing이 결과 이미지를 바꾸지 않았는지 ----
+    std::vector<unsigned char> a((size_t)W * H * 4), b((size_t)W * H * 4);
+    glBindFramebuffer(GL_FRAMEBUFFER, outNaive.fbo);
+    glReadPixels(0, 0, W, H, GL_RGBA, GL_UNSIGNED_BYTE, a.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, outCompiled.fbo);
+    glReadPixels(0, 0, W, H, GL_RGBA, GL_UNSIGNED_BYTE, b.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    bool same = std::memcmp(a.data(), b.data(), a.size()) == 0;
+    std::vector<unsigned char> c((size_t)W * H * 4);
+    glBindFramebuffer(GL_FRAMEBUFFER, outInOrder.fbo);
+    glReadPixels(0, 0, W, H, GL_RGBA, GL_UNSIGNED_BYTE, c.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    same = same && std::memcmp(a.data(), c.data(), a.size()) == 0;
+
+    // naive의 bind 횟수는 대부분 bind(0)이므로 비교에 쓰지 않는다.
+    // reorder만 다른 in-order와 target 전환 횟수를 비교해야 실행 순서 정렬로 실제로 줄어든 FBO 전환이 보인다.
+    const RenderGraphStats& sn = naive.stats();
+    const RenderGraphStats& si = inOrder.stats();
+    const RenderGraphStats& sc = compiled.stats();
+    std::printf("\n[verify]\n");
+    std::printf("  output images identical: %s\n", same ? "yes" : "NO");
+    std::printf("  peak transient memory: %.1f%% of naive, FBO target changes (in-order -> compiled): %d -> %d\n",
+                100.0 * (double)sc.physicalBytes / (double)sn.physicalBytes, si.targetChanges, sc.targetChanges);
+
+    naive.release();
+    inOrder.release();
+    compiled.release();
+    destroyRenderTarget(outNaive);
+    destroyRenderTarget(outInOrder);
+    destroyRenderTarget(outCompiled);
+    destroyPrograms(P);
+    destroyHeadlessContext(hc);
+
+    const bool ok = same && sc.physicalBytes < sn.physicalBytes && sc.targetChanges < si.targetChanges &&
+                    sc.fboBinds == sc.targetChanges;
+    if (!ok) {
+        std::fprintf(stderr, "render graph did not preserve the image or did not reduce memory/binds!\n");
+        return 1;
+    }
+    return 0;
+}
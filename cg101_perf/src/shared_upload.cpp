@@ -0,0 +1,466 @@
+// src/shared_upload.cpp
+// perf-9: share context worker thread에서 큰 asset을 올리는 동안 main context는 계속 그린다
+//   - asset 하나 = 큰 texture(+mip chain) + grid mesh(VBO/EBO) + 전용 program
+//   - main은 같은 asset들을 view 4개(각자 FBO, 서로 다른 view 행렬)로 매 frame 그린다
+//   - frame은 목표 fps 간격으로 진행한다 (vsync 대용). 남는 시간에 worker가 CPU를 쓴다.
+// 같은 load 일정으로 두 가지 방식을 비교한다.
+//   - sync   : 요청한 frame에 main thread가 직접 생성/upload/compile (그 frame이 멈춘다)
+//   - worker : SharedGlWorker에 넘기고, fence가 signal 된 뒤 main이 VAO만 만들어 사용
+// frame 시간 분포, 가장 긴 frame, load로 늘어난 시간의 합을 출력하고 마지막 이미지가 같은지 검증한다.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_util.hpp>
+#include <cg101/shared_context.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+static const char* kAssetVs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    layout (location = 1) in vec2 aUv;
+    uniform mat3 uView;
+    out vec2 vUv;
+    void main() {
+        vec3 p = uView * vec3(aPos, 1.0);
+        gl_Position = vec4(p.xy, 0.0, 1.0);
+        vUv = aUv;
+    }
+)GLSL";
+
+// asset마다 tint 상수가 다른 source로 compile한다 (driver의 shader cache가 재사용하지 못하도록)
+static std::string assetFs(int k) {
+    char tint[96];
+    std::snprintf(tint, sizeof(tint), "const vec3 kTint = vec3(%.3f, %.3f, %.3f);\n",
+                  0.6f + 0.4f * std::sin((float)k * 1.3f), 0.6f + 0.4f * std::sin((float)k * 2.1f + 1.0f),
+                  0.6f + 0.4f * std::sin((float)k * 0.7f + 2.0f));
+    std::string s = "#version 330 core\n";
+    s += tint;
+    s += R"GLSL(
+    in vec2 vUv;
+    uniform sampler2D uTex;
+    out vec4 FragColor;
+    void main() {
+        FragColor = vec4(texture(uTex, vUv).rgb * kTint, 1.0);
+    }
+)GLSL";
+    return s;
+}
+
+// buffer/texture/program은 share context 사이에서 공유되고, VAO는 그린 context에서 따로 만든다
+struct Asset {
+    GLuint  vbo = 0, ebo = 0, tex = 0, program = 0;
+    GLint   locView = -1;
+    GLsizei indexCount = 0;
+
+    GLuint  vao = 0;            // main context 전용
+    bool    visible = false;
+    int     requestFrame = -1;
+    int     visibleFrame = -1;
+    SharedGlWorker::Ticket ticket = 0;
+};
+
+struct LoadConfig {
+    int texSize = 2048;
+    int grid    = 24;
+    int assets  = 6;   // frame 도중에 load하는 asset 수 (처음부터 있는 resident asset 1개는 별도)
+};
+
+static void makeVao(Asset& a) {
+    glGenVertexArrays(1, &a.vao);
+    glBindVertexArray(a.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, a.vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, a.ebo);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+}
+
+static void drawAsset(const Asset& a, const float* view) {
+    glUseProgram(a.program);
+    glUniformMatrix3fv(a.locView, 1, GL_FALSE, view);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, a.tex);
+    glBindVertexArray(a.vao);
+    glDrawElements(GL_TRIANGLES, a.indexCount, GL_UNSIGNED_INT, nullptr);
+}
+
+// asset k를 생성한다: CPU에서 texel/mip/정점 생성(decode 대용) -> upload -> compile/link.
+// 호출한 thread의 current context에서 실행된다 (sync: main, worker: share context).
+static void loadAsset(Asset& a, int k, const LoadConfig& cfg) {
+    // ---- texture ----
+    const int S = cfg.texSize;
+    std::vector<uint32_t> texels((size_t)S * S);
+    const int cell = std::max(1, S / (8 + k));
+    for (int y = 0; y < S; ++y) {
+        for (int x = 0; x < S; ++x) {
+            const uint32_t r = (uint32_t)(x * 255 / S);
+            const uint32_t g = (uint32_t)(y * 255 / S);
+            const uint32_t b = (((x / cell) + (y / cell)) & 1) ? 230u : 40u;
+            texels[(size_t)y * S + x] = r | (g << 8) | (b << 16) | (255u << 24);
+        }
+    }
+    // mip chain도 CPU에서 만든다 (asset 파일에 미리 들어 있는 mip에 해당).
+    // glGenerateMipmap은 GPU 작업이라 worker에서 불러도 main의 draw와 같은 GPU 시간을 나눠 쓴다.
+    // llvmpipe는 context가 달라도 rasterizer를 한 번에 하나씩만 돌리므로 main frame이 그만큼 멈춘다.
+    glGenTextures(1, &a.tex);
+    glBindTexture(GL_TEXTURE_2D, a.tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    int level = 0, size = S;
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    std::vector<uint32_t> mip;
+    while (size > 1) {
+        const int half = size / 2;
+        mip.resize((size_t)half * half);
+        for (int y = 0; y < half; ++y) {
+            const uint32_t* r0 = &texels[(size_t)(2 * y) * size];
+            const uint32_t* r1 = r0 + size;
+            for (int x = 0; x < half; ++x) {
+                const uint32_t p[4] = { r0[2 * x], r0[2 * x + 1], r1[2 * x], r1[2 * x + 1] };
+                uint32_t out = 0;
+                for (int c = 0; c < 32; c += 8) {
+                    const uint32_t sum = ((p[0] >> c) & 255u) + ((p[1] >> c) & 255u) + ((p[2] >> c) & 255u) + ((p[3] >> c) & 255u);
+                    out |= ((sum + 2u) / 4u) << c;
+                }
+                mip[(size_t)y * half + x] = out;
+            }
+        }
+        texels.swap(mip);
+        size = half;
+        glTexImage2D(GL_TEXTURE_2D, ++level, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // ---- mesh: asset 자리(3열 grid)에 놓인 물결 모양 원판 ----
+    const int N = cfg.grid;
+    const float cx = -0.66f + 0.66f * (float)(k % 3);
+    const float cy =  0.5f - 0.66f * (float)((k / 3) % 3);
+    std::vector<float> verts((size_t)N * N * 4);
+    for (int j = 0; j < N; ++j) {
+        for (int i = 0; i < N; ++i) {
+            const float u = (float)i / (float)(N - 1), v = (float)j / (float)(N - 1);
+            const float ang = u * 6.2831853f;
+            const float rad = v * (0.28f + 0.03f * std::sin(ang * (float)(3 + k)));
+            float* p = &verts[((size_t)j * N + i) * 4];
+            p[0] = cx + rad * std::cos(ang);
+            p[1] = cy + rad * std::sin(ang);
+            p[2] = u;
+            p[3] = v;
+        }
+    }
+    std::vector<uint32_t> idx;
+    idx.reserve((size_t)(N - 1) * (N - 1) * 6);
+    for (int j = 0; j + 1 < N; ++j) {
+        for (int i = 0; i + 1 < N; ++i) {
+            const uint32_t v0 = (uint32_t)(j * N + i), v1 = v0 + 1, v2 = v0 + (uint32_t)N, v3 = v2 + 1;
+            idx.insert(idx.end(), { v0, v1, v3, v0, v3, v2 });
+        }
+    }
+    glGenBuffers(1, &a.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, a.vbo);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(verts.size() * sizeof(float)), verts.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glGenBuffers(1, &a.ebo);
+    glBindBuffer(GL_ARRAY_BUFFER, a.ebo); // EBO는 VAO에 묶이므로 여기서는 ARRAY_BUFFER로 upload만 한다
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(idx.size() * sizeof(uint32_t)), idx.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    a.indexCount = (GLsizei)idx.size();
+
+    // ---- program ----
+    const std::string fs = assetFs(k);
+    a.program = makeProgram(kAssetVs, fs.c_str());
+    a.locView = glGetUniformLocation(a.program, "uView");
+    glUseProgram(a.program);
+    glUniform1i(glGetUniformLocation(a.program, "uTex"), 0);
+
+    // driver는 link 뒤 첫 draw에서 shader를 마저 compile하기도 한다 (llvmpipe의 variant JIT).
+    // 같은 형식의 1x1 target에 한 번 그려 그 비용도 load 쪽에서 치른다. VAO/FBO는 이 context 전용으로 만들고 버린다.
+    RenderTarget warm = makeRenderTarget(1, 1);
+    glBindFramebuffer(GL_FRAMEBUFFER, warm.fbo);
+    glViewport(0, 0, 1, 1);
+    const float identity[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    makeVao(a);
+    drawAsset(a, identity);
+    glBindVertexArray(0);
+    glDeleteVertexArrays(1, &a.vao);
+    a.vao = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    destroyRenderTarget(warm);
+    glUseProgram(0);
+}
+
+static void destroyAsset(Asset& a) {
+    glDeleteVertexArrays(1, &a.vao);
+    glDeleteBuffers(1, &a.vbo);
+    glDeleteBuffers(1, &a.ebo);
+    glDeleteTextures(1, &a.tex);
+    glDeleteProgram(a.program);
+    a = {};
+}
+
+struct RunResult {
+    std::vector<double>   frameMs;          // main thread가 frame 하나에 쓴 시간 (대기 제외)
+    int                   missed = 0;       // 목표 frame 간격을 넘긴 frame 수
+    double                mainLoadMs = 0.0; // main thread가 load/hand-off에 쓴 시간
+    double                workerMs   = 0.0;
+    double                latencyFrames = 0.0;
+    std::vector<uint64_t> viewHashes;           // 모든 asset이 보이는 마지막 상태
+    std::vector<std::vector<uint64_t>> firstUseHashes; // asset별, 처음 보이게 된 frame에서 그 asset만 그린 view
+};
+
+static const int kViews = 4;
+
+// view v: 서로 다른 회전/확대 (같은 asset을 다른 camera로 보는 창 4개에 해당)
+static void viewMatrix(int v, int frame, float* m) {
+    const float rad = 0.15f * (float)v + 0.01f * (float)frame;
+    const float s = 1.0f + 0.25f * (float)v;
+    const float c = std::cos(rad) * s, sn = std::sin(rad) * s;
+    const float m3[9] = { c, sn, 0.0f,  -sn, c, 0.0f,  -0.1f * (float)v, 0.05f * (float)v, 1.0f };
+    std::memcpy(m, m3, sizeof(m3));
+}
+
+// only >= 0이면 그 asset만 그린다 (visible 여부와 무관)
+static void renderViews(const std::vector<Asset>& assets, const std::vector<RenderTarget>& views, int frame,
+                        int only = -1) {
+    for (int v = 0; v < (int)views.size(); ++v) {
+        glBindFramebuffer(GL_FRAMEBUFFER, views[v].fbo);
+        glViewport(0, 0, views[v].w, views[v].h);
+        glClearColor(0.07f, 0.07f, 0.09f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        float m[9];
+        viewMatrix(v, frame, m);
+        for (int k = 0; k < (int)assets.size(); ++k)
+            if (only >= 0 ? k == only : assets[(size_t)k].visible) drawAsset(assets[(size_t)k], m);
+    }
+    glBindVertexArray(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+static std::vector<uint64_t> hashViews(const std::vector<RenderTarget>& views) {
+    std::vector<uint64_t> hashes;
+    for (const RenderTarget& rt : views) {
+        std::vector<uint8_t> px((size_t)rt.w * rt.h * 4);
+        glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+        glReadPixels(0, 0, rt.w, rt.h, GL_RGBA, GL_UNSIGNED_BYTE, px.data());
+        hashes.push_back(fnv1a64(px.data(), px.size()));
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return hashes;
+}
+
+// 방금 보이게 된 asset을 frame 번호와 무관한 고정 view로 그 asset만 그려 hash한다.
+// 이 frame의 render보다 먼저 그리므로 hand-off 직후의 첫 사용을 검사한다: worker가 올린 내용이 이 시점에 아직
+// 완전하지 않으면 마지막 frame에서는 맞더라도 여기서 다르게 나온다. 두 방식 모두 같은 조건으로 그리므로 비교할 수 있다.
+static void hashFirstUse(const std::vector<Asset>& assets, int k, const std::vector<RenderTarget>& views, RunResult& res) {
+    renderViews(assets, views, 0, k);
+    res.firstUseHashes[(size_t)k] = hashViews(views);
+}
+
+// asset 0은 처음부터 있고, asset k(1..assets)는 frame firstLoad + (k - 1) * spacing에 요청된다 (두 방식 모두 같은 일정)
+static RunResult runScene(const LoadConfig& cfg, int frames, int firstLoad, int spacing, double periodMs,
+                          const std::vector<RenderTarget>& views, SharedGlWorker* worker) {
+    RunResult res;
+    res.firstUseHashes.resize((size_t)cfg.assets + 1);
+    std::vector<Asset> assets((size_t)cfg.assets + 1);
+    loadAsset(assets[0], 0, cfg);
+    makeVao(assets[0]);
+    assets[0].visible = true;
+    glFinish();
+
+    using clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::milli>(periodMs));
+    auto deadline = clock::now();
+
+    Stopwatch sw, sl, sv;
+    std::vector<int> shown;
+    for (int f = 0; f < frames; ++f) {
+        sw.reset();
+        deadline += period;
+        shown.clear();
+
+        // ---- load 요청 ----
+        for (int k = 1; k <= cfg.assets; ++k) {
+            if (f != firstLoad + (k - 1) * spacing) continue;
+            Asset& a = assets[(size_t)k];
+            a.requestFrame = f;
+            sl.reset();
+            if (!worker) {
+                loadAsset(a, k, cfg);
+                makeVao(a);
+                a.visible = true;
+                a.visibleFrame = f;
+                shown.push_back(k);
+            } else {
+                a.ticket = worker->submit([&a, k, &cfg]() { loadAsset(a, k, cfg); });
+            }
+            res.mainLoadMs += sl.elapsed_ms();
+        }
+
+        // ---- hand-off: fence가 signal 된 asset만 main context로 가져온다 ----
+        if (worker) {
+            sl.reset();
+            for (int k = 0; k < (int)assets.size(); ++k) {
+                Asset& a = assets[(size_t)k];
+                if (a.requestFrame < 0 || a.visible || !worker->ready(a.ticket)) continue;
+                makeVao(a);
+                a.visible = true;
+                a.visibleFrame = f;
+                shown.push_back(k);
+            }
+            res.mainLoadMs += sl.elapsed_ms();
+        }
+
+        // 검증용 render는 frame 시간과 vsync 일정에서 뺀다
+        sv.reset();
+        for (int k : shown) hashFirstUse(assets, k, views, res);
+        const double verifyMs = sv.elapsed_ms();
+        deadline += std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::milli>(verifyMs));
+
+        renderViews(assets, views, f);
+        glFinish(); // swap 대용: frame의 GPU 작업까지 포함해 잰다
+        const double ms = sw.elapsed_ms() - verifyMs;
+        res.frameMs.push_back(ms);
+
+        // 다음 vsync까지 대기. 이미 늦었으면 일정을 현재 시각으로 다시 맞춘다 (밀린 frame을 몰아서 그리지 않는다).
+        if (ms > periodMs) ++res.missed;
+        if (clock::now() < deadline) std::this_thread::sleep_until(deadline);
+        else                         deadline = clock::now();
+    }
+
+    // 아직 도착하지 않은 asset은 acquire로 기다린다 (glWaitSync: CPU는 worker의 job 완료까지만 대기)
+    if (worker) {
+        for (int k = 0; k < (int)assets.size(); ++k) {
+            Asset& a = assets[(size_t)k];
+            if (a.requestFrame < 0 || a.visible) continue;
+            worker->acquire(a.ticket);
+            makeVao(a);
+            a.visible = true;
+            a.visibleFrame = frames;
+            hashFirstUse(assets, k, views, res);
+        }
+        res.workerMs = worker->workerBusyMs();
+    }
+
+    int requested = 0;
+    for (const Asset& a : assets) {
+        if (a.requestFrame < 0) continue;
+        res.latencyFrames += (double)(a.visibleFrame - a.requestFrame);
+        ++requested;
+    }
+    if (requested) res.latencyFrames /= (double)requested;
+
+    // 모든 asset이 보이는 상태의 같은 frame을 그려 두 방식의 결과를 비교한다
+    renderViews(assets, views, frames);
+    glFinish();
+    res.viewHashes = hashViews(views);
+
+    for (Asset& a : assets) destroyAsset(a);
+    return res;
+}
+
+static void printRun(const char* name, const RunResult& r) {
+    std::vector<double> s = r.frameMs;
+    std::sort(s.begin(), s.end());
+    const double median = s[s.size() / 2];
+    const double p95 = s[std::min(s.size() - 1, (size_t)((double)s.size() * 0.95))];
+    double excess = 0.0, total = 0.0;
+    int spikes = 0;
+    for (double v : r.frameMs) {
+        total += v;
+        excess += std::max(0.0, v - median);
+        if (v > 2.0 * median) ++spikes;
+    }
+    std::printf("  %-8s median %7.2f  p95 %7.2f  max %8.2f ms | missed %2d | >2x median %2d | stall sum %8.2f ms"
+                " | busy %8.1f ms\n", name, median, p95, s.back(), r.missed, spikes, excess, total);
+    std::printf("  %-8s main-thread load/hand-off %8.2f ms, worker jobs %8.2f ms, request -> visible %.1f frames\n",
+                "", r.mainLoadMs, r.workerMs, r.latencyFrames);
+}
+
+int main(int argc, char** argv) {
+    LoadConfig cfg;
+    if (argc > 1) cfg.assets  = std::max(1, std::atoi(argv[1]));
+    if (argc > 2) cfg.texSize = std::max(16, std::atoi(argv[2]));
+    bool surfaceless = false;
+    if (argc > 3) {
+        if      (std::strcmp(argv[3], "surfaceless") == 0) surfaceless = true;
+        else if (std::strcmp(argv[3], "pbuffer") != 0) {
+            std::fprintf(stderr, "usage: %s [assets] [texture size] [pbuffer|surfaceless] [fps]\n", argv[0]);
+            return 1;
+        }
+    }
+    const double fps = (argc > 4) ? std::max(1.0, std::atof(argv[4])) : 30.0;
+    const double periodMs = 1000.0 / fps;
+    const int firstLoad = 4, spacing = 6;
+    const int frames = firstLoad + cfg.assets * spacing + 10;
+    const int viewSize = 256;
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+
+    SharedGlWorker worker;
+    if (!worker.start(hc, surfaceless)) exit(1);
+
+    const double texMb = (double)cfg.texSize * cfg.texSize * 4.0 * (4.0 / 3.0) / (1024.0 * 1024.0);
+    std::printf("%d assets (texture %dx%d + mips = %.1f MB, %dx%d grid mesh, own program), "
+                "%d views %dx%d, %d frames, worker context: %s, %s\n\n",
+                cfg.assets, cfg.texSize, cfg.texSize, texMb, cfg.grid, cfg.grid,
+                kViews, viewSize, viewSize, frames, surfaceless ? "surfaceless" : "1x1 pbuffer",
+                worker.runsInBackground() ? "SCHED_IDLE" : "normal priority");
+
+    std::vector<RenderTarget> views;
+    for (int v = 0; v < kViews; ++v) views.push_back(makeRenderTarget(viewSize, viewSize));
+
+    // 같은 driver 상태(첫 compile 등)에서 시작하도록 한 번 버리는 run
+    LoadConfig warm = cfg;
+    warm.assets = 1;
+    warm.texSize = 64;
+    runScene(warm, firstLoad + 2, firstLoad, spacing, 0.0, views, nullptr);
+
+    const RunResult sync = runScene(cfg, frames, firstLoad, spacing, periodMs, views, nullptr);
+    const RunResult async = runScene(cfg, frames, firstLoad, spacing, periodMs, views, &worker);
+
+    std::printf("[main thread frame times, target %.1f fps = %.2f ms]\n", fps, periodMs);
+    printRun("sync", sync);
+    printRun("worker", async);
+
+    std::vector<double> a = sync.frameMs, b = async.frameMs;
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    std::printf("\n  longest frame %.2f -> %.2f ms (%.1fx), main-thread load time %.2f -> %.2f ms"
+                " (+ %.2f ms waiting in acquire after the last frame)\n",
+                a.back(), b.back(), a.back() / std::max(b.back(), 1e-6), sync.mainLoadMs, async.mainLoadMs,
+                worker.acquireWaitMs());
+
+    int firstUseDiff = 0;
+    for (int k = 1; k <= cfg.assets; ++k)
+        if (sync.firstUseHashes[(size_t)k].empty() || sync.firstUseHashes[(size_t)k] != async.firstUseHashes[(size_t)k])
+            ++firstUseDiff;
+    const bool finalSame = sync.viewHashes == async.viewHashes;
+    const bool ok = finalSame && firstUseDiff == 0;
+    std::printf("\n[verify] %d views on the frame each asset first appears: %d/%d assets identical\n",
+                kViews, cfg.assets - firstUseDiff, cfg.assets);
+    std::printf("[verify] %d views after all loads: %s\n", kViews, finalSame ? "identical" : "DIFFERENT");
+
+    worker.stop();
+    for (RenderTarget& rt : views) destroyRenderTarget(rt);
+    destroyHeadlessContext(hc);
+    if (!ok) {
+        std::fprintf(stderr, "worker-loaded assets render differently from main-thread loads!\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,320 @@
+// src/spatial_query.cpp
+// perf-3: CH3-2의 T*R*S로 배치한 2D triangle 다수에 대한 공간 질의
+//   - UniformGrid (매 frame incremental update) / Bvh2 (정적) / brute force
+//   - point picking, AABB range, k-nearest neighbors
+// build/update/query 처리량을 측정하고, 일부 query는 brute force 결과와 비교해 검증한다.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <cg101/parallel.hpp>
+#include <cg101/spatial_index.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+// 객체 하나의 transform 파라미터 (p' = T * R * S * p, CH3-2와 같은 합성 순서)
+struct Placement {
+    float tx, ty;   // translation
+    float theta;    // rotation (rad)
+    float sx, sy;   // non-uniform scale
+    float vx, vy;   // frame당 이동량
+    float omega;    // frame당 회전량
+};
+
+static float hash01(uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352du;
+    x ^= x >> 15; x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// CH1/CH3의 기준 triangle (-0.5,-0.5), (0.5,-0.5), (0,0.5)에 T*R*S를 적용
+static Triangle2 transformTriangle(const Placement& p) {
+    const float c = std::cos(p.theta);
+    const float s = std::sin(p.theta);
+    auto apply = [&](float x, float y, float& ox, float& oy) {
+        x *= p.sx; y *= p.sy;            // S
+        ox = c * x - s * y + p.tx;       // R, T
+        oy = s * x + c * y + p.ty;
+    };
+    Triangle2 t;
+    apply(-0.5f, -0.5f, t.x0, t.y0);
+    apply( 0.5f, -0.5f, t.x1, t.y1);
+    apply( 0.0f,  0.5f, t.x2, t.y2);
+    return t;
+}
+
+static void updateGeometry(const std::vector<Placement>& pl, std::vector<Triangle2>& tris,
+                           std::vector<Aabb2>& boxes) {
+    parallelFor(0, pl.size(), [&](size_t b, size_t e, unsigned) {
+        for (size_t i = b; i < e; ++i) {
+            tris[i]  = transformTriangle(pl[i]);
+            boxes[i] = bounds(tris[i]);
+        }
+    });
+}
+
+// ---- brute force 기준 구현 ----
+static void brutePick(const std::vector<Triangle2>& tris, float x, float y, std::vector<uint32_t>& out) {
+    out.clear();
+    for (uint32_t i = 0; i < tris.size(); ++i)
+        if (point_in_triangle(tris[i], x, y)) out.push_back(i);
+}
+
+static void bruteRange(const std::vector<Aabb2>& boxes, const Aabb2& r, std::vector<uint32_t>& out) {
+    out.clear();
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+        if (overlaps(boxes[i], r)) out.push_back(i);
+}
+
+static void bruteKnnDist(const std::vector<Aabb2>& boxes, float x, float y, size_t k, std::vector<float>& out) {
+    std::vector<float> d(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) d[i] = centerDistSq(boxes[i], x, y);
+    k = std::min(k, d.size());
+    std::partial_sort(d.begin(), d.begin() + k, d.end());
+    out.assign(d.begin(), d.begin() + k);
+}
+
+// AABB 후보 -> triangle 내부 판정으로 picking 확정
+static void filterPick(const std::vector<Triangle2>& tris, float x, float y, std::vector<uint32_t>& ids) {
+    ids.erase(std::remove_if(ids.begin(), ids.end(),
+                             [&](uint32_t id) { return !point_in_triangle(tris[id], x, y); }),
+              ids.end());
+}
+
+struct QuerySet {
+    std::vector<float> px, py; // point / knn query 위치
+    std::vector<Aabb2> ranges;
+};
+
+// 모든 query를 thread로 나눠 실행하고 (ms, 결과 개수 합)을 돌려준다
+template <class Fn>
+static double runQueries(size_t q, Fn&& fn, size_t& hits) {
+    std::vector<size_t> partial(parallelChunkCount(q, 0, 1), 0);
+    Stopwatch sw;
+    parallelFor(0, q, [&](size_t b, size_t e, unsigned chunk) {
+        std::vector<uint32_t> out;
+        size_t h = 0;
+        for (size_t i = b; i < e; ++i) { fn(i, out); h += out.size(); }
+        partial[chunk] = h;
+    }, 0, 1);
+    const double ms = sw.elapsed_ms();
+    hits = 0;
+    for (size_t h : partial) hits += h;
+    return ms;
+}
+
+static void printQuery(const char* label, size_t q, double ms, size_t hits) {
+    std::printf("  %-26s %9.2f ms  %8.2f M query/s  (avg %.2f results)\n",
+                label, ms, (double)q / (ms * 1e3), (double)hits / (double)q);
+}
+
+int main(int argc, char** argv) {
+    const size_t n       = (argc > 1) ? (size_t)std::atoll(argv[1]) : 1000000;
+    const size_t queries = (argc > 2) ? (size_t)std::atoll(argv[2]) : 100000;
+    const size_t k       = 8;
+    const size_t verifyQ = 200;
+    const int    frames  = 5;
+
+    // 밀도를 고정: 객체당 평균 4 unit^2
+    const float worldSize = std::sqrt((float)n) * 2.0f;
+    const Aabb2 world = { 0.0f, 0.0f, worldSize, worldSize };
+    const float cellSize = 2.0f;
+
+    std::printf("objects = %zu, world = %.0f x %.0f, queries = %zu, threads = %u\n\n",
+                n, worldSize, worldSize, queries, workerCount());
+
+    std::vector<Placement> pl(n);
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t h = (uint32_t)i * 7u;
+        pl[i].tx    = hash01(h + 0) * worldSize;
+        pl[i].ty    = hash01(h + 1) * worldSize;
+        pl[i].theta = hash01(h + 2) * 6.2831853f;
+        pl[i].sx    = 0.3f + 0.9f * hash01(h + 3);
+        pl[i].sy    = 0.3f + 0.9f * hash01(h + 4);
+        pl[i].vx    = (hash01(h + 5) - 0.5f) * 0.1f;
+        pl[i].vy    = (hash01(h + 6) - 0.5f) * 0.1f;
+        pl[i].omega = 0.02f;
+    }
+
+    std::vector<Triangle2> tris(n);
+    std::vector<Aabb2> boxes(n);
+    updateGeometry(pl, tris, boxes);
+
+    // ---- build ----
+    std::printf("[build]\n");
+    UniformGrid grid;
+    Stopwatch sw;
+    grid.build(boxes, world, cellSize);
+    std::printf("  %-26s %9.2f ms  (%zu cells)\n", "grid full build", sw.elapsed_ms(), grid.cellCount());
+
+    Bvh2 bvh;
+    sw.reset();
+    bvh.build(boxes);
+    std::printf("  %-26s %9.2f ms  (%zu nodes)\n", "BVH build", sw.elapsed_ms(), bvh.nodeCount());
+
+    // ---- frame마다 이동 + incremental update ----
+    // 전체를 다시 배치하지 않은(= incremental 경로만 탄) frame은 그 직후 grid 상태를 brute force와 비교한다
+    std::printf("\n[per-frame update, %d frames]\n", frames);
+    const size_t frameQ = std::min<size_t>(16, n);
+    double geomMs = 0.0, updateMs = 0.0;
+    size_t moved = 0, relocated = 0, frameMismatches = 0;
+    int fallbacks = 0;
+    std::vector<uint32_t> fa, fb;
+    std::vector<float> fref, fd;
+    for (int f = 0; f < frames; ++f) {
+        for (Placement& p : pl) { p.tx += p.vx; p.ty += p.vy; p.theta += p.omega; }
+        sw.reset();
+        updateGeometry(pl, tris, boxes);
+        geomMs += sw.elapsed_ms();
+
+        sw.reset();
+        grid.update(boxes);
+        updateMs += sw.elapsed_ms();
+        moved     += grid.lastUpdateMoved();
+        relocated += grid.lastUpdateRelocated();
+        if (grid.lastUpdateFellBack()) { ++fallbacks; continue; }
+
+        for (size_t i = 0; i < frameQ; ++i) {
+            const uint32_t h = 0x9E3779B9u + (uint32_t)(f * frameQ + i) * 3u;
+            const float x = hash01(h + 0) * worldSize, y = hash01(h + 1) * worldSize;
+            const Aabb2 r = { x, y, x + 3.0f, y + 3.0f };
+            bruteRange(boxes, r, fa);
+            grid.queryRange(r, fb);
+            std::sort(fa.begin(), fa.end());
+            std::sort(fb.begin(), fb.end());
+            frameMismatches += fa != fb;
+
+            bruteKnnDist(boxes, x, y, k, fref);
+            grid.knn(x, y, k, fb);
+            fd.clear();
+            for (uint32_t id : fb) fd.push_back(centerDistSq(boxes[id], x, y));
+            frameMismatches += fd != fref;
+        }
+    }
+    std::printf("  %-26s %9.2f ms/frame\n", "transform + AABB", geomMs / frames);
+    std::printf("  %-26s %9.2f ms/frame  (avg %.0f moved, %.0f relocated entries, %d/%d frames fell back to full relayout)\n",
+                "grid incremental update", updateMs / frames, (double)moved / frames, (double)relocated / frames,
+                fallbacks, frames);
+    std::printf("  %-26s %zu queries x (range, knn) x %d frames vs brute force: %zu mismatches\n",
+                "incremental frames check", frameQ, frames - fallbacks, frameMismatches);
+
+    sw.reset();
+    UniformGrid rebuilt;
+    rebuilt.build(boxes, world, cellSize);
+    std::printf("  %-26s %9.2f ms  (for comparison)\n", "grid full rebuild", sw.elapsed_ms());
+
+    // 이동 후의 scene은 정적 BVH에 다시 반영해야 한다 (BVH는 refit/rebuild 대상)
+    bvh.build(boxes);
+
+    // ---- queries ----
+    QuerySet qs;
+    qs.px.resize(queries);
+    qs.py.resize(queries);
+    qs.ranges.resize(queries);
+    for (size_t i = 0; i < queries; ++i) {
+        const uint32_t h = 0x51ED270Bu + (uint32_t)i * 5u;
+        qs.px[i] = hash01(h + 0) * worldSize;
+        qs.py[i] = hash01(h + 1) * worldSize;
+        const float rx = hash01(h + 2) * worldSize, ry = hash01(h + 3) * worldSize;
+        const float rw = 1.0f + 4.0f * hash01(h + 4);
+        qs.ranges[i] = { rx, ry, rx + rw, ry + rw };
+    }
+
+    std::printf("\n[queries]\n");
+    size_t hits = 0;
+    double ms;
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        grid.queryPoint(qs.px[i], qs.py[i], out);
+        filterPick(tris, qs.px[i], qs.py[i], out);
+    }, hits);
+    printQuery("grid pick", queries, ms, hits);
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        bvh.queryPoint(qs.px[i], qs.py[i], out);
+        filterPick(tris, qs.px[i], qs.py[i], out);
+    }, hits);
+    printQuery("BVH pick", queries, ms, hits);
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        grid.queryRange(qs.ranges[i], out);
+    }, hits);
+    printQuery("grid range", queries, ms, hits);
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        bvh.queryRange(qs.ranges[i], out);
+    }, hits);
+    printQuery("BVH range", queries, ms, hits);
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        grid.knn(qs.px[i], qs.py[i], k, out);
+    }, hits);
+    printQuery("grid knn (k=8)", queries, ms, hits);
+
+    ms = runQueries(queries, [&](size_t i, std::vector<uint32_t>& out) {
+        bvh.knn(qs.px[i], qs.py[i], k, out);
+    }, hits);
+    printQuery("BVH knn (k=8)", queries, ms, hits);
+
+    const size_t bq = std::min(verifyQ, queries);
+    ms = runQueries(bq, [&](size_t i, std::vector<uint32_t>& out) {
+        bruteRange(boxes, qs.ranges[i], out);
+    }, hits);
+    printQuery("brute force range", bq, ms, hits);
+
+    // ---- 검증: brute force와 결과 집합 비교 ----
+    size_t mismatches = 0;
+    std::vector<uint32_t> a, b, c;
+    std::vector<float> ref, da, db;
+    auto sameSet = [](std::vector<uint32_t> x, std::vector<uint32_t> y) {
+        std::sort(x.begin(), x.end());
+        std::sort(y.begin(), y.end());
+        return x == y;
+    };
+    auto knnDists = [&](const std::vector<uint32_t>& ids, float x, float y, std::vector<float>& d) {
+        d.clear();
+        for (uint32_t id : ids) d.push_back(centerDistSq(boxes[id], x, y));
+    };
+
+    for (size_t i = 0; i < bq; ++i) {
+        const float x = qs.px[i], y = qs.py[i];
+
+        brutePick(tris, x, y, a);
+        grid.queryPoint(x, y, b); filterPick(tris, x, y, b);
+        bvh.queryPoint(x, y, c);  filterPick(tris, x, y, c);
+        mismatches += !sameSet(a, b) + !sameSet(a, c);
+
+        bruteRange(boxes, qs.ranges[i], a);
+        grid.queryRange(qs.ranges[i], b);
+        bvh.queryRange(qs.ranges[i], c);
+        mismatches += !sameSet(a, b) + !sameSet(a, c);
+
+        // 거리가 같은 후보는 id가 달라도 정답이므로 거리 목록으로 비교한다
+        bruteKnnDist(boxes, x, y, k, ref);
+        grid.knn(x, y, k, b); knnDists(b, x, y, da);
+        bvh.knn(x, y, k, c);  knnDists(c, x, y, db);
+        mismatches += (da != ref) + (db != ref);
+    }
+
+    // k = 0은 빈 결과
+    grid.knn(qs.px[0], qs.py[0], 0, b);
+    bvh.knn(qs.px[0], qs.py[0], 0, c);
+    mismatches += !b.empty() + !c.empty();
+
+    std::printf("\n[verify] %zu queries x (pick, range, knn) x (grid, BVH) vs brute force: %zu mismatches\n",
+                bq, mismatches);
+
+    if (mismatches != 0 || frameMismatches != 0) {
+        std::fprintf(stderr, "spatial index results differ from brute force!\n");
+        return 1;
+    }
+    if (fallbacks == frames) {
+        std::fprintf(stderr, "every frame fell back to a full relayout; the incremental path was not exercised\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,178 @@
+// src/trace_capture.cpp
+// perf-7: CH1 / CH3-1 / CH3-2 scene을 headless로 그리면서 GL 호출을 binary trace로 기록한다
+//   - glad 함수 포인터를 기록용 thunk로 교체 (scene 코드는 평소처럼 glXxx를 호출)
+//   - frame마다 begin/end marker, 마지막에 결과 이미지의 hash를 기록
+// 기록한 trace는 trace_replay로 window 없이 재생하고 호출별 시간을 측정한다.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_trace.hpp>
+#include <cg101/gl_util.hpp>
+
+using namespace cg101;
+
+static const float kPi = 3.14159265358979323846f;
+
+// CH1: 고정 triangle + uColor
+static const char* kCh1Vs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    void main() {
+        gl_Position = vec4(aPos, 0.0, 1.0);
+    }
+)GLSL";
+
+static const char* kCh1Fs = R"GLSL(
+    #version 330 core
+    out vec4 FragColor;
+    uniform vec3 uColor;
+    void main() {
+        FragColor = vec4(uColor, 1.0);
+    }
+)GLSL";
+
+// CH3-1: mat2 선형 변환
+static const char* kCh31Vs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    uniform mat2 uM; // 2x2 linear transform
+    void main() {
+        gl_Position = vec4(uM * aPos, 0.0, 1.0);
+    }
+)GLSL";
+
+// CH3-2: mat3 affine 변환 (동차좌표)
+static const char* kCh32Vs = R"GLSL(
+    #version 330 core
+    layout (location = 0) in vec2 aPos;
+    uniform mat3 uM; // 2D affine transform in homogeneous coordinates
+    void main() {
+        vec3 tp = uM * vec3(aPos, 1.0);
+        gl_Position = vec4(tp.xy, 0.0, 1.0);
+    }
+)GLSL";
+
+static const char* kOrangeFs = R"GLSL(
+    #version 330 core
+    out vec4 FragColor;
+    void main() {
+        FragColor = vec4(0.95, 0.65, 0.20, 1.0);
+    }
+)GLSL";
+
+enum class Scene { Ch1, Ch31, Ch32 };
+
+static bool parseScene(const char* s, Scene& out) {
+    if (std::strcmp(s, "ch1") == 0)   { out = Scene::Ch1;  return true; }
+    if (std::strcmp(s, "ch3-1") == 0) { out = Scene::Ch31; return true; }
+    if (std::strcmp(s, "ch3-2") == 0) { out = Scene::Ch32; return true; }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <ch1|ch3-1|ch3-2> <out.cgtrace> [frames] [draws/frame]\n", argv[0]);
+        return 1;
+    }
+    Scene scene;
+    if (!parseScene(argv[1], scene)) {
+        std::fprintf(stderr, "unknown scene '%s' (ch1, ch3-1, ch3-2)\n", argv[1]);
+        return 1;
+    }
+    const char* outPath = argv[2];
+    const int frames = (argc > 3) ? std::atoi(argv[3]) : 60;
+    const int draws  = (argc > 4) ? std::atoi(argv[4]) : 200;
+    const int W = 800, H = 600; // CH1/CH3 window 크기
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+
+    TraceWriter trace;
+    startTraceCapture(trace);
+
+    // ---- setup: 이 아래의 GL 호출은 모두 기록된다 ----
+    RenderTarget rt = makeRenderTarget(W, H);
+
+    const char* vs = scene == Scene::Ch1 ? kCh1Vs : (scene == Scene::Ch31 ? kCh31Vs : kCh32Vs);
+    const char* fs = scene == Scene::Ch1 ? kCh1Fs : kOrangeFs;
+    GLuint program = makeProgram(vs, fs);
+    GLint loc = glGetUniformLocation(program, scene == Scene::Ch1 ? "uColor" : "uM");
+
+    const float verts[] = {
+        -0.5f, -0.5f,
+         0.5f, -0.5f,
+         0.0f,  0.5f
+    };
+    GLuint vao = 0, vbo = 0;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(verts), verts, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+
+    // ---- frames: CH1 render loop 한 반복 = clear + draw들 (swap 대신 end marker) ----
+    // 물체 하나 대신 draws개의 triangle을 frame/인덱스에 따라 다른 uniform으로 그린다.
+    const int grid = (int)std::ceil(std::sqrt((double)draws));
+    for (int f = 0; f < frames; ++f) {
+        traceBeginFrame();
+        glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+        glViewport(0, 0, W, H);
+        glClearColor(0.07f, 0.07f, 0.09f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glUseProgram(program);
+        glBindVertexArray(vao);
+        for (int d = 0; d < draws; ++d) {
+            const float t = (float)f / (float)frames + (float)d / (float)draws;
+            if (scene == Scene::Ch1) {
+                glUniform3f(loc, 0.5f + 0.5f * std::cos(2.0f * kPi * t), 0.5f + 0.5f * std::sin(2.0f * kPi * t), 0.6f);
+            } else {
+                const float rad = 2.0f * kPi * t;
+                const float c = std::cos(rad), s = std::sin(rad);
+                const float sx = 1.3f / (float)grid * 2.0f, sy = 0.9f / (float)grid * 2.0f;
+                if (scene == Scene::Ch31) {
+                    // M = R * S (column-major)
+                    const float m[4] = { c * sx, s * sx, -s * sy, c * sy };
+                    glUniformMatrix2fv(loc, 1, GL_FALSE, m);
+                } else {
+                    // M = T * R * S: triangle마다 grid 위의 다른 위치
+                    const float tx = ((float)(d % grid) + 0.5f) / (float)grid * 2.0f - 1.0f;
+                    const float ty = ((float)(d / grid) + 0.5f) / (float)grid * 2.0f - 1.0f;
+                    const float m[9] = { c * sx, s * sx, 0.0f,  -s * sy, c * sy, 0.0f,  tx, ty, 1.0f };
+                    glUniformMatrix3fv(loc, 1, GL_FALSE, m);
+                }
+            }
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        glBindVertexArray(0);
+        traceEndFrame();
+    }
+
+    // ---- 마지막 frame의 결과 hash (replay가 같은 이미지를 만드는지 확인) ----
+    glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+    const uint64_t hash = traceChecksum(0, 0, W, H);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+    destroyRenderTarget(rt);
+
+    if (!stopTraceCapture()) exit(1);
+    if (!trace.save(outPath)) exit(1);
+
+    std::printf("scene %s: %d frames x %d draws -> %s\n", argv[1], frames, draws, outPath);
+    std::printf("  %zu records, %zu bytes (%.1f bytes/record), image hash %016llx\n",
+                trace.records(), trace.bytes(), (double)trace.bytes() / (double)trace.records(),
+                (unsigned long long)hash);
+
+    destroyHeadlessContext(hc);
+    return 0;
+}
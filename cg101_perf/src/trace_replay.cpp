@@ -0,0 +1,109 @@
+// src/trace_replay.cpp
+// perf-7: trace_capture가 기록한 GL command trace를 window 없이 재생한다
+//   1) setup 구간(shader compile, buffer upload)을 1회 실행
+//   2) frame 구간을 loops번 반복: 호출별 시간 측정 pass와, 측정 없이 최대 속도로 도는 pass
+//   3) teardown 구간의 checksum으로 결과 이미지가 capture와 같은지 확인
+// 같은 trace를 CI에서 반복 재생하면 scene 코드나 window loop 없이 frame의 GL 작업량을 그대로 재현할 수 있다.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_replay.hpp>
+#include <cg101/timer.hpp>
+
+using namespace cg101;
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <trace.cgtrace> [loops]\n", argv[0]);
+        return 1;
+    }
+    const int loops = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 5;
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+
+    Trace trace;
+    if (!loadTrace(argv[1], trace)) exit(1);
+    std::printf("trace %s: %zu bytes, %zu records, %d frames, loops = %d\n\n",
+                argv[1], trace.data.size(), trace.cmds.size(), trace.frames, loops);
+
+    // frame 구간 [BeginFrame, EndFrame]
+    std::vector<std::pair<size_t, size_t>> frames;
+    for (size_t k = trace.frameBegin; k < trace.frameEnd; ++k) {
+        if (trace.cmds[k].op == TraceOp::BeginFrame) frames.push_back({ k, k });
+        if (trace.cmds[k].op == TraceOp::EndFrame && !frames.empty()) frames.back().second = k + 1;
+    }
+
+    TracePlayer player;
+
+    // ---- 1) setup ----
+    Stopwatch sw;
+    player.run(trace, 0, trace.frameBegin, true);
+    glFinish();
+    const double setupMs = sw.elapsed_ms();
+
+    // ---- 2-a) 호출별 시간 측정 ----
+    std::vector<double> frameMs;
+    player.resetStats();
+    for (int l = 0; l < loops; ++l) {
+        for (const auto& fr : frames) {
+            sw.reset();
+            player.run(trace, fr.first, fr.second, true);
+            frameMs.push_back(sw.elapsed_ms());
+        }
+    }
+
+    // ---- 2-b) 측정 overhead 없이 최대 속도 ----
+    sw.reset();
+    for (int l = 0; l < loops; ++l) player.run(trace, trace.frameBegin, trace.frameEnd, false);
+    const double fastMs = sw.elapsed_ms();
+    const size_t fastFrames = (size_t)loops * frames.size();
+
+    // ---- 3) checksum + teardown ----
+    player.run(trace, trace.frameEnd, trace.cmds.size(), false);
+
+    std::printf("[per-call timing, %d loops]\n", loops);
+    std::printf("  %-28s %10s %12s %10s %10s\n", "call", "count", "total ms", "avg us", "max us");
+    std::vector<int> ops;
+    for (int op = 1; op < (int)TraceOp::Count; ++op)
+        if (player.stats((TraceOp)op).calls) ops.push_back(op);
+    std::sort(ops.begin(), ops.end(), [&](int a, int b) {
+        return player.stats((TraceOp)a).ns > player.stats((TraceOp)b).ns;
+    });
+    for (int op : ops) {
+        const TraceOpStats& s = player.stats((TraceOp)op);
+        std::printf("  %-28s %10llu %12.3f %10.3f %10.1f\n", traceLayout((TraceOp)op).name,
+                    (unsigned long long)s.calls, s.ns * 1e-6, s.ns * 1e-3 / (double)s.calls, s.maxNs * 1e-3);
+    }
+
+    std::vector<double> sorted = frameMs;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (double v : frameMs) sum += v;
+    std::printf("\n[frames]\n");
+    std::printf("  setup (compile + upload)      %9.3f ms\n", setupMs);
+    if (!sorted.empty()) {
+        std::printf("  timed replay  min / median / mean / max = %.3f / %.3f / %.3f / %.3f ms\n",
+                    sorted.front(), sorted[sorted.size() / 2], sum / (double)sorted.size(), sorted.back());
+    }
+    if (fastFrames) {
+        std::printf("  untimed replay %zu frames in %.2f ms -> %.3f ms/frame (%.1f fps)\n",
+                    fastFrames, fastMs, fastMs / (double)fastFrames, 1000.0 * (double)fastFrames / fastMs);
+    }
+
+    const bool ok = player.checksums() > 0 && player.checksumMismatches() == 0;
+    std::printf("\n[verify] image checksum: %d checked, %d mismatches -> %s\n",
+                player.checksums(), player.checksumMismatches(), ok ? "identical to capture" : "DIFFERENT");
+
+    destroyHeadlessContext(hc);
+    if (!ok) {
+        std::fprintf(stderr, "replayed image differs from the captured one!\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,299 @@
+// src/transform_bench.cpp
+// perf-5: 프로젝트 고유의 Mat4/Affine3 변환 라이브러리
+//   - column-major 4x4 곱 (SSE/AVX), affine/rigid 전용 역행렬, quaternion TRS 합성
+//   - point(w=1) / direction(w=0) 배열의 batch 변환 (AoS SSE, SoA AVX, thread 분할)
+// 정확성을 scalar 기준과 비교하고, 1M matrix 곱과 100M point 변환 처리량을 측정한다.
+// glm이 설치되어 있으면(CG101_HAVE_GLM) 같은 작업을 glm으로도 측정해 나란히 출력한다.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <cg101/parallel.hpp>
+#include <cg101/timer.hpp>
+#include <cg101/transform.hpp>
+
+#if defined(CG101_HAVE_GLM)
+#include <glm/glm.hpp>
+#endif
+
+using namespace cg101;
+
+static float hash01(uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352du;
+    x ^= x >> 15; x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return (float)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// 임의의 TRS: scale은 0.5 ~ 2 (비균등), 회전은 임의 축
+static Affine3 randomTrs(uint32_t seed, bool withScale) {
+    const uint32_t h = seed * 16u;
+    const Vec3 t    = { hash01(h + 0) * 20.0f - 10.0f, hash01(h + 1) * 20.0f - 10.0f, hash01(h + 2) * 20.0f - 10.0f };
+    const Vec3 axis = { hash01(h + 3) - 0.5f, hash01(h + 4) - 0.5f, hash01(h + 5) - 0.5f + 1e-3f };
+    const Vec3 s    = withScale ? Vec3{ 0.5f + 1.5f * hash01(h + 6), 0.5f + 1.5f * hash01(h + 7), 0.5f + 1.5f * hash01(h + 8) }
+                                : Vec3{ 1.0f, 1.0f, 1.0f };
+    return compose_trs(t, quat_from_axis_angle(axis, hash01(h + 9) * 6.2831853f), s);
+}
+
+static float maxAbsDiff(const Mat4& a, const Mat4& b) {
+    float e = 0.0f;
+    for (int i = 0; i < 16; ++i) e = std::fmax(e, std::fabs(a.m[i] - b.m[i]));
+    return e;
+}
+
+static float maxAbsDiff(const std::vector<float>& a, const std::vector<float>& b) {
+    float e = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) e = std::fmax(e, std::fabs(a[i] - b[i]));
+    return e;
+}
+
+// CH3-2 방식의 개별 행렬
+static Mat4 translateMat(Vec3 t) {
+    Mat4 m = mat4_identity();
+    m.m[12] = t.x; m.m[13] = t.y; m.m[14] = t.z;
+    return m;
+}
+
+static Mat4 scaleMat(Vec3 s) {
+    Mat4 m = mat4_identity();
+    m.m[0] = s.x; m.m[5] = s.y; m.m[10] = s.z;
+    return m;
+}
+
+static Mat4 rotateZMat(float rad) {
+    Mat4 m = mat4_identity();
+    const float c = std::cos(rad), s = std::sin(rad);
+    m.m[0] = c;  m.m[1] = s;
+    m.m[4] = -s; m.m[5] = c;
+    return m;
+}
+
+static Mat4 rotateXMat(float rad) {
+    Mat4 m = mat4_identity();
+    const float c = std::cos(rad), s = std::sin(rad);
+    m.m[5] = c;  m.m[6] = s;
+    m.m[9] = -s; m.m[10] = c;
+    return m;
+}
+
+static void printRate(const char* label, size_t items, const char* unit, double ms) {
+    std::printf("  %-34s %9.2f ms  %8.1f M %s/s\n", label, ms, (double)items / (ms * 1e3), unit);
+}
+
+int main(int argc, char** argv) {
+    const size_t pointCount = (argc > 1) ? (size_t)std::atoll(argv[1]) : 1000000;
+    const int    passes     = (argc > 2) ? std::atoi(argv[2]) : 100;
+    const size_t matCount   = 65536;
+    const int    matReps    = 16; // 65536 x 16 = 1M matrix 곱
+
+    // ---- 0) 정확성 ----
+    float mulErr = 0.0f, invErr = 0.0f, affErr = 0.0f, rigidErr = 0.0f;
+    int invFailures = 0; // 가역인 TRS인데 역행렬 계산이 실패한 수
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const Mat4 a = to_mat4(randomTrs(i, true));
+        const Mat4 b = to_mat4(randomTrs(i + 5000, true));
+        mulErr = std::fmax(mulErr, maxAbsDiff(mul(a, b), mul_scalar(a, b)));
+
+        // M * M^-1 = I
+        Mat4 inv;
+        const bool invOk = inverse_general(a, inv);
+        if (invOk) invErr = std::fmax(invErr, maxAbsDiff(mul(a, inv), mat4_identity()));
+        else       ++invFailures;
+
+        // affine 전용 역 == 일반 역
+        Affine3 ainv;
+        if (!inverse_affine(to_affine(a), ainv)) ++invFailures;
+        else if (invOk)                          affErr = std::fmax(affErr, maxAbsDiff(to_mat4(ainv), inv));
+
+        // rigid 전용 역 == affine 역 (scale 없는 경우)
+        const Affine3 r = randomTrs(i + 9000, false);
+        Affine3 rinv;
+        if (inverse_affine(r, rinv)) rigidErr = std::fmax(rigidErr, maxAbsDiff(to_mat4(inverse_rigid(r)), to_mat4(rinv)));
+        else                         ++invFailures;
+    }
+
+    // quaternion TRS == T * Rz * Rx * S (CH3-2의 행렬 곱 순서)
+    const Vec3 t = { 1.0f, -2.0f, 3.0f }, s = { 2.0f, 0.5f, 1.5f };
+    const float az = 0.7f, ax = -1.2f;
+    const Mat4 ref = mul(translateMat(t), mul(rotateZMat(az), mul(rotateXMat(ax), scaleMat(s))));
+    const Quat q = quat_mul(quat_from_axis_angle({ 0.0f, 0.0f, 1.0f }, az), quat_from_axis_angle({ 1.0f, 0.0f, 0.0f }, ax));
+    const float trsErr = maxAbsDiff(to_mat4(compose_trs(t, q, s)), ref);
+
+    // CH3-4: 이동만 있는 행렬은 point를 옮기고 direction은 그대로 둔다
+    const Mat4 tr = translateMat({ 5.0f, 6.0f, 7.0f });
+    const float v3[3] = { 1.0f, 2.0f, 3.0f };
+    float p3[3], d3[3];
+    transformPoints(tr, v3, p3, 1);
+    transformDirections(tr, v3, d3, 1);
+    const bool wOk = p3[0] == 6.0f && p3[1] == 8.0f && p3[2] == 10.0f &&
+                     d3[0] == 1.0f && d3[1] == 2.0f && d3[2] == 3.0f;
+
+    std::printf("[verify]\n");
+    std::printf("  SIMD mul vs scalar         max |err| = %.2e\n", mulErr);
+    std::printf("  M * inverse_general(M) - I max |err| = %.2e\n", invErr);
+    std::printf("  inverse_affine vs general  max |err| = %.2e\n", affErr);
+    std::printf("  inverse_rigid vs affine    max |err| = %.2e\n", rigidErr);
+    std::printf("  failed inverses of invertible TRS: %d\n", invFailures);
+    std::printf("  compose_trs vs T*Rz*Rx*S   max |err| = %.2e\n", trsErr);
+    std::printf("  point w=1 / direction w=0: %s\n\n", wOk ? "ok" : "FAILED");
+
+    // ---- 1) matrix 곱 ----
+    std::vector<Mat4> A(matCount), B(matCount), C(matCount);
+    for (size_t i = 0; i < matCount; ++i) {
+        A[i] = to_mat4(randomTrs((uint32_t)i, true));
+        B[i] = to_mat4(randomTrs((uint32_t)(i + matCount), true));
+    }
+    const size_t mulCount = matCount * matReps;
+    float checksum = 0.0f; // 최적화로 loop가 사라지지 않도록 결과를 사용
+
+    std::printf("[Mat4 multiply x %zu]\n", mulCount);
+    Stopwatch sw;
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) C[i] = mul_scalar(A[i], B[(i + r) % matCount]);
+    printRate("scalar", mulCount, "mul", sw.elapsed_ms());
+    checksum += C[matCount / 2].m[5];
+
+    sw.reset();
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) C[i] = mul(A[i], B[(i + r) % matCount]);
+#if defined(__AVX__)
+    printRate("AVX (2 columns / register)", mulCount, "mul", sw.elapsed_ms());
+#else
+    printRate("SSE", mulCount, "mul", sw.elapsed_ms());
+#endif
+    checksum += C[matCount / 2].m[5];
+
+    std::vector<Affine3> AA(matCount), AB(matCount), AC(matCount);
+    for (size_t i = 0; i < matCount; ++i) { AA[i] = to_affine(A[i]); AB[i] = to_affine(B[i]); }
+    sw.reset();
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) AC[i] = mul(AA[i], AB[(i + r) % matCount]);
+    printRate("Affine3 (3x4)", mulCount, "mul", sw.elapsed_ms());
+    checksum += AC[matCount / 2].c1.y;
+
+#if defined(CG101_HAVE_GLM)
+    {
+        std::vector<glm::mat4> GA(matCount), GB(matCount), GC(matCount);
+        for (size_t i = 0; i < matCount; ++i)
+            for (int c = 0; c < 4; ++c)
+                for (int r = 0; r < 4; ++r) { GA[i][c][r] = A[i].m[c * 4 + r]; GB[i][c][r] = B[i].m[c * 4 + r]; }
+        sw.reset();
+        for (int r = 0; r < matReps; ++r)
+            for (size_t i = 0; i < matCount; ++i) GC[i] = GA[i] * GB[(i + r) % matCount];
+        printRate("glm::mat4", mulCount, "mul", sw.elapsed_ms());
+        checksum += GC[matCount / 2][1][1];
+    }
+#endif
+
+    // ---- 2) 역행렬 ----
+    std::printf("\n[inverse x %zu]\n", mulCount);
+    sw.reset();
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) inverse_general(A[i], C[i]);
+    printRate("general 4x4 (cofactor)", mulCount, "inv", sw.elapsed_ms());
+    checksum += C[matCount / 2].m[5];
+
+    sw.reset();
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) inverse_affine(AA[i], AC[i]);
+    printRate("affine (cross / det)", mulCount, "inv", sw.elapsed_ms());
+    checksum += AC[matCount / 2].c1.y;
+
+    sw.reset();
+    for (int r = 0; r < matReps; ++r)
+        for (size_t i = 0; i < matCount; ++i) AC[i] = inverse_rigid(AA[i]);
+    printRate("rigid (transpose)", mulCount, "inv", sw.elapsed_ms());
+    checksum += AC[matCount / 2].c1.y;
+
+    // ---- 3) batch point 변환 ----
+    const size_t totalPoints = pointCount * (size_t)passes;
+    std::printf("\n[point transform: %zu points x %d passes = %zu]\n", pointCount, passes, totalPoints);
+
+    std::vector<float> aos(pointCount * 3), outRef(pointCount * 3), outAos(pointCount * 3);
+    std::vector<float> sx(pointCount), sy(pointCount), sz(pointCount);
+    std::vector<float> ox(pointCount), oy(pointCount), oz(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        const uint32_t h = (uint32_t)i * 3u + 77u;
+        sx[i] = aos[i * 3 + 0] = hash01(h + 0) * 2.0f - 1.0f;
+        sy[i] = aos[i * 3 + 1] = hash01(h + 1) * 2.0f - 1.0f;
+        sz[i] = aos[i * 3 + 2] = hash01(h + 2) * 2.0f - 1.0f;
+    }
+    const Mat4 M = to_mat4(randomTrs(42, true));
+
+    sw.reset();
+    for (int p = 0; p < passes; ++p) transformPointsScalar(M, aos.data(), outRef.data(), pointCount);
+    printRate("scalar AoS", totalPoints, "pt", sw.elapsed_ms());
+
+    sw.reset();
+    for (int p = 0; p < passes; ++p) transformPoints(M, aos.data(), outAos.data(), pointCount);
+    printRate("SSE AoS (4 points, shuffle)", totalPoints, "pt", sw.elapsed_ms());
+
+    sw.reset();
+    for (int p = 0; p < passes; ++p)
+        transformPointsSoA(M, sx.data(), sy.data(), sz.data(), ox.data(), oy.data(), oz.data(), pointCount);
+#if defined(__AVX__)
+    printRate("AVX SoA (8 points / register)", totalPoints, "pt", sw.elapsed_ms());
+#else
+    printRate("SSE SoA (4 points / register)", totalPoints, "pt", sw.elapsed_ms());
+#endif
+
+    sw.reset();
+    for (int p = 0; p < passes; ++p) {
+        parallelFor(0, pointCount, [&](size_t b, size_t e, unsigned) {
+            transformPointsSoA(M, sx.data() + b, sy.data() + b, sz.data() + b,
+                               ox.data() + b, oy.data() + b, oz.data() + b, e - b);
+        });
+    }
+    char label[64];
+    std::snprintf(label, sizeof(label), "SoA, %u threads", workerCount());
+    printRate(label, totalPoints, "pt", sw.elapsed_ms());
+
+#if defined(CG101_HAVE_GLM)
+    {
+        glm::mat4 GM;
+        for (int c = 0; c < 4; ++c)
+            for (int r = 0; r < 4; ++r) GM[c][r] = M.m[c * 4 + r];
+        const glm::vec3* in = reinterpret_cast<const glm::vec3*>(aos.data());
+        std::vector<glm::vec3> gout(pointCount);
+        sw.reset();
+        for (int p = 0; p < passes; ++p)
+            for (size_t i = 0; i < pointCount; ++i) gout[i] = glm::vec3(GM * glm::vec4(in[i], 1.0f));
+        printRate("glm (mat4 * vec4(p, 1))", totalPoints, "pt", sw.elapsed_ms());
+        checksum += gout[pointCount / 2].y;
+    }
+#endif
+
+    std::vector<float> soaAsAos(pointCount * 3);
+    for (size_t i = 0; i < pointCount; ++i) {
+        soaAsAos[i * 3 + 0] = ox[i]; soaAsAos[i * 3 + 1] = oy[i]; soaAsAos[i * 3 + 2] = oz[i];
+    }
+    const float aosErr = maxAbsDiff(outRef, outAos);
+    const float soaErr = maxAbsDiff(outRef, soaAsAos);
+
+    // direction 변환도 SoA와 AoS가 같은 결과를 내야 한다
+    transformDirectionsScalar(M, aos.data(), outRef.data(), pointCount);
+    transformDirections(M, aos.data(), outAos.data(), pointCount);
+    transformDirectionsSoA(M, sx.data(), sy.data(), sz.data(), ox.data(), oy.data(), oz.data(), pointCount);
+    float dirErr = maxAbsDiff(outRef, outAos);
+    for (size_t i = 0; i < pointCount; ++i) {
+        dirErr = std::fmax(dirErr, std::fabs(outRef[i * 3 + 0] - ox[i]));
+        dirErr = std::fmax(dirErr, std::fabs(outRef[i * 3 + 1] - oy[i]));
+        dirErr = std::fmax(dirErr, std::fabs(outRef[i * 3 + 2] - oz[i]));
+    }
+
+    std::printf("\n[verify batch vs scalar]\n");
+    std::printf("  points AoS max |err| = %.2e, SoA max |err| = %.2e, directions max |err| = %.2e\n",
+                aosErr, soaErr, dirErr);
+    std::printf("  (checksum %.3f)\n", checksum);
+
+    // FMA 축약 여부에 따라 scalar와 SIMD의 rounding이 다를 수 있으므로 허용 오차로 비교
+    const bool ok = invFailures == 0 && mulErr <= 1e-4f && invErr <= 1e-4f && affErr <= 1e-4f && rigidErr <= 1e-4f &&
+                    trsErr <= 1e-5f && wOk && aosErr <= 1e-5f && soaErr <= 1e-5f && dirErr <= 1e-5f;
+    if (!ok) {
+        std::fprintf(stderr, "transform results differ from scalar reference!\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,355 @@
+// src/vertex_formats.cpp
+// perf-1: 같은 mesh를 float32 / half / snorm16 + 10_10_10_2 layout으로 인코딩해
+//         VBO 크기, 인코딩 속도, 업로드 시간, 렌더 시간, 화질 차이를 비교한다.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <cg101/egl_context.hpp>
+#include <cg101/gl_util.hpp>
+#include <cg101/timer.hpp>
+#include <cg101/vertex_format.hpp>
+
+using namespace cg101;
+
+// 입력 mesh: 높이장 sin(x)cos(y)를 가진 N x N grid (2D position + 3D normal + uv)
+struct SourceMesh {
+    std::vector<float>    pos; // 2 per vertex, world 단위 [-10, 10]
+    std::vector<float>    nrm; // 3 per vertex, unit length
+    std::vector<float>    uv;  // 2 per vertex, [0, 1]
+    std::vector<uint32_t> indices;
+    size_t vertexCount = 0;
+};
+
+static SourceMesh makeGrid(int n) {
+    SourceMesh m;
+    m.vertexCount = (size_t)n * n;
+    m.pos.resize(m.vertexCount * 2);
+    m.nrm.resize(m.vertexCount * 3);
+    m.uv.resize(m.vertexCount * 2);
+
+    const float extent = 10.0f;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const size_t v = (size_t)j * n + i;
+            const float u = (float)i / (float)(n - 1);
+            const float w = (float)j / (float)(n - 1);
+            const float x = (u * 2.0f - 1.0f) * extent;
+            const float y = (w * 2.0f - 1.0f) * extent;
+
+            // h = sin(x)cos(y) 의 gradient로부터 normal = normalize(-dh/dx, -dh/dy, 1)
+            const float dx = std::cos(x) * std::cos(y);
+            const float dy = -std::sin(x) * std::sin(y);
+            const float len = std::sqrt(dx * dx + dy * dy + 1.0f);
+
+            m.pos[v * 2 + 0] = x;
+            m.pos[v * 2 + 1] = y;
+            m.nrm[v * 3 + 0] = -dx / len;
+            m.nrm[v * 3 + 1] = -dy / len;
+            m.nrm[v * 3 + 2] = 1.0f / len;
+            m.uv[v * 2 + 0]  = u;
+            m.uv[v * 2 + 1]  = w;
+        }
+    }
+
+    m.indices.reserve((size_t)(n - 1) * (n - 1) * 6);
+    for (int j = 0; j + 1 < n; ++j) {
+        for (int i = 0; i + 1 < n; ++i) {
+            const uint32_t a = (uint32_t)(j * n + i);
+            const uint32_t b = a + 1;
+            const uint32_t c = a + (uint32_t)n;
+            const uint32_t d = c + 1;
+            m.indices.insert(m.indices.end(), { a, b, d, a, d, c });
+        }
+    }
+    return m;
+}
+
+struct Variant {
+    const char* name;
+    AttribType  posType;
+    AttribType  nrmType;
+    AttribType  uvType;
+    bool        quantizePos; // AABB remap 후 snorm으로 저장
+
+    VertexLayout layout() const {
+        VertexLayout l;
+        l.add(0, posType, 2).add(1, nrmType, 3).add(2, uvType, 2);
+        return l;
+    }
+};
+
+// 한 component의 허용 오차 (quantization step 1개 + float 반올림 여유)
+static float tolerance(AttribType t, float value, float decodeScale) {
+    switch (t) {
+        case AttribType::Float32:         return 1e-6f * std::fabs(value);
+        case AttribType::Half16:          return std::fabs(value) * (1.0f / 2048.0f) + 1e-7f;
+        case AttribType::Snorm16:         return decodeScale * (1.0f / 32767.0f) + 1e-6f * std::fabs(value);
+        case AttribType::Unorm16:         return decodeScale * (1.0f / 65535.0f) + 1e-6f * std::fabs(value);
+        case AttribType::Snorm8:          return decodeScale * (1.0f / 127.0f);
+        case AttribType::Unorm8:          return decodeScale * (1.0f / 255.0f);
+        case AttribType::Snorm10_10_10_2: return decodeScale * (1.0f / 511.0f);
+    }
+    return 0.0f;
+}
+
+// 인코딩된 VBO를 CPU에서 decode해 원본과 비교. 최대 오차를 출력하고 허용치 초과 시 false.
+static bool verifyAttrib(const char* label, AttribType type, int comps, const float* src, size_t n,
+                         const uint8_t* vbo, size_t stride, GLuint offset, const AttribRemap* remap) {
+    float maxErr = 0.0f;
+    bool ok = true;
+    for (size_t i = 0; i < n; ++i) {
+        float out[4];
+        decodeAttrib(type, comps, vbo + i * stride + offset, out, remap);
+        for (int c = 0; c < comps; ++c) {
+            const float ref = src[i * comps + c];
+            const float err = std::fabs(out[c] - ref);
+            const float tol = tolerance(type, ref, remap ? remap->decodeScale[c] : 1.0f);
+            if (err > maxErr) maxErr = err;
+            if (err > tol) ok = false;
+        }
+    }
+    std::printf("    %-7s max |err| = %.3e %s\n", label, maxErr, ok ? "" : "  <-- FAILED");
+    return ok;
+}
+
+// encodeAttrib(SIMD 경로 포함)가 모든 type x components 조합에서 detail::encodeScalar와 bit 단위로 같은지 확인한다.
+// 입력은 clamp 경계, ±0, 범위 밖, half subnormal/overflow, 반올림 중간값을 섞고, remap 경로도 함께 본다.
+static bool verifyEncodeMatchesScalar() {
+    const float edges[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f, 1.0000001f, -1.0000001f, 2.0f, -2.0f, 1e6f, -1e30f,
+        INFINITY, -INFINITY,
+        6.0e-8f, -2.98e-8f, 3.0e-8f, 1.0e-5f, -6.1e-5f, 6.1035156e-5f, // half subnormal / 최소 normal 근처
+        65504.0f, 65519.0f, 65520.0f, -70000.0f,                        // half max / overflow 경계
+        1.5f / 32767.0f, 0.5f / 127.0f, 2.5f / 65535.0f, 0.5f / 255.0f, 1.5f / 511.0f, // 정수화 직전 .5
+        0.3f, -0.7f, 0.999f, 1e-3f,
+    };
+    const size_t ne = sizeof(edges) / sizeof(edges[0]);
+    const AttribType types[] = {
+        AttribType::Float32, AttribType::Half16, AttribType::Snorm16, AttribType::Unorm16,
+        AttribType::Snorm8, AttribType::Unorm8, AttribType::Snorm10_10_10_2,
+    };
+
+    AttribRemap remap;
+    const float scale[4] = { 2.0f, 0.5f, 3.0f, -1.0f };
+    const float bias[4]  = { 0.25f, -0.1f, 1.0f, 0.0f };
+    std::memcpy(remap.scale, scale, sizeof(scale));
+    std::memcpy(remap.bias, bias, sizeof(bias));
+
+    size_t combos = 0, mismatches = 0;
+    for (AttribType t : types) {
+        for (int comps = 1; comps <= 4; ++comps) {
+            // 원소 i의 component c = edges[(i * 7 + c * 3) % ne] : 각 edge 값이 모든 lane 위치에 나타난다
+            const size_t n = ne * 4;
+            std::vector<float> src(n * comps);
+            for (size_t i = 0; i < n; ++i)
+                for (int c = 0; c < comps; ++c) src[i * comps + c] = edges[(i * 7 + c * 3) % ne];
+
+            for (const AttribRemap* r : { (const AttribRemap*)nullptr, (const AttribRemap*)&remap }) {
+                const size_t bytes = attribBytes(t, comps);
+                const size_t stride = bytes + 3; // 정렬되지 않은 stride도 같이 확인
+                std::vector<uint8_t> simd(stride * n, 0xCD), ref(stride * n, 0xCD);
+                encodeAttrib(t, comps, src.data(), n, simd.data(), stride, r);
+
+                size_t bad = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    float tmp[4];
+                    for (int c = 0; c < comps; ++c)
+                        tmp[c] = r ? src[i * comps + c] * r->scale[c] + r->bias[c] : src[i * comps + c];
+                    detail::encodeScalar(t, comps, tmp, ref.data() + i * stride);
+                    bad += std::memcmp(simd.data() + i * stride, ref.data() + i * stride, stride) != 0;
+                }
+                ++combos;
+                mismatches += bad;
+                if (bad != 0)
+                    std::printf("    type %d, %d comps%s: %zu / %zu elements differ from encodeScalar\n",
+                                (int)t, comps, r ? " (remap)" : "", bad, n);
+            }
+        }
+    }
+    std::printf("encode vs scalar reference: %zu type/comps/remap combos, %zu mismatching elements\n\n",
+                combos, mismatches);
+    return mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+    const int gridN  = (argc > 1) ? std::atoi(argv[1]) : 512;
+    const int frames = (argc > 2) ? std::atoi(argv[2]) : 10;
+    const int W = 1024, H = 1024;
+
+    HeadlessContext hc;
+    if (!createHeadlessContext(hc)) exit(1);
+    std::printf("GL_RENDERER = %s\n", (const char*)glGetString(GL_RENDERER));
+
+    const bool haveAttribFormat = GLAD_GL_VERSION_4_3 != 0;
+    std::printf("vertex setup path = %s\n\n",
+                haveAttribFormat ? "glVertexAttribFormat (GL 4.3)" : "glVertexAttribPointer (GL 3.3)");
+
+    bool allOk = verifyEncodeMatchesScalar();
+
+    SourceMesh mesh = makeGrid(gridN);
+    std::printf("mesh: %dx%d grid, %zu vertices, %zu triangles\n\n",
+                gridN, gridN, mesh.vertexCount, mesh.indices.size() / 3);
+
+    // decode 규칙은 layout과 무관하게 하나의 shader로 처리: float layout이면 uPosScale=1, uPosBias=0
+    const char* vsSrc = R"GLSL(
+        #version 330 core
+        layout (location = 0) in vec2 aPos;
+        layout (location = 1) in vec3 aNormal;
+        layout (location = 2) in vec2 aUV;
+
+        uniform vec2 uPosScale; // quantized position 역변환
+        uniform vec2 uPosBias;
+
+        out vec3 vNormal;
+        out vec2 vUV;
+
+        void main() {
+            vec2 p = aPos * uPosScale + uPosBias; // world [-10, 10]
+            vNormal = aNormal;
+            vUV = aUV;
+            gl_Position = vec4(p * 0.095, 0.0, 1.0);
+        }
+    )GLSL";
+
+    const char* fsSrc = R"GLSL(
+        #version 330 core
+        in vec3 vNormal;
+        in vec2 vUV;
+        out vec4 FragColor;
+        void main() {
+            vec3 L = normalize(vec3(0.4, 0.5, 0.75));
+            float ndl = max(dot(normalize(vNormal), L), 0.0);
+            FragColor = vec4(vec3(vUV, 0.6) * (0.15 + 0.85 * ndl), 1.0);
+        }
+    )GLSL";
+
+    GLuint program = makeProgram(vsSrc, fsSrc);
+    GLint locScale = glGetUniformLocation(program, "uPosScale");
+    GLint locBias  = glGetUniformLocation(program, "uPosBias");
+
+    GLuint ebo = 0;
+    glGenBuffers(1, &ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t),
+                 mesh.indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    RenderTarget rt = makeRenderTarget(W, H);
+
+    const Variant variants[] = {
+        { "float32",             AttribType::Float32, AttribType::Float32,         AttribType::Float32, false },
+        { "half",                AttribType::Half16,  AttribType::Half16,          AttribType::Half16,  false },
+        { "snorm16+10_10_10_2",  AttribType::Snorm16, AttribType::Snorm10_10_10_2, AttribType::Unorm16, true  },
+    };
+
+    std::vector<uint8_t> referencePixels;
+    const double baseBytes = (double)variants[0].layout().stride() * mesh.vertexCount;
+
+    std::printf("%-20s %6s %9s %8s %10s %9s %9s %10s %10s\n",
+                "layout", "B/vtx", "VBO(MB)", "saved", "encode", "enc MB/s", "upload", "frame", "fetch GB/s");
+
+    for (const Variant& var : variants) {
+        const VertexLayout layout = var.layout();
+        const size_t stride = layout.stride();
+        const auto& at = layout.attribs();
+        std::vector<uint8_t> vbo(stride * mesh.vertexCount);
+
+        AttribRemap posRemap;
+        if (var.quantizePos) posRemap = boundsRemap(mesh.pos.data(), mesh.vertexCount, 2, true);
+        const AttribRemap* pr = var.quantizePos ? &posRemap : nullptr;
+
+        // ---- CPU encode ----
+        Stopwatch sw;
+        encodeAttrib(at[0].type, 2, mesh.pos.data(), mesh.vertexCount, vbo.data() + at[0].offset, stride, pr);
+        encodeAttrib(at[1].type, 3, mesh.nrm.data(), mesh.vertexCount, vbo.data() + at[1].offset, stride);
+        encodeAttrib(at[2].type, 2, mesh.uv.data(),  mesh.vertexCount, vbo.data() + at[2].offset, stride);
+        const double encodeMs = sw.elapsed_ms();
+
+        // ---- GPU upload ----
+        GLuint vao = 0, vb = 0;
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vb);
+        glFinish();
+
+        sw.reset();
+        glBindBuffer(GL_ARRAY_BUFFER, vb);
+        glBufferData(GL_ARRAY_BUFFER, vbo.size(), vbo.data(), GL_STATIC_DRAW);
+        glFinish();
+        const double uploadMs = sw.elapsed_ms();
+
+        glBindVertexArray(vao);
+        if (haveAttribFormat) {
+            layout.applyFormat(0);
+            glBindVertexBuffer(0, vb, 0, (GLsizei)stride);
+        } else {
+            layout.applyPointers();
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // ---- Render: frames회 draw 후 glFinish까지의 평균 ----
+        glBindFramebuffer(GL_FRAMEBUFFER, rt.fbo);
+        glViewport(0, 0, W, H);
+        glUseProgram(program);
+        glUniform2f(locScale, posRemap.decodeScale[0], posRemap.decodeScale[1]);
+        glUniform2f(locBias,  posRemap.decodeBias[0],  posRemap.decodeBias[1]);
+        glBindVertexArray(vao);
+
+        auto drawOnce = [&]() {
+            glClearColor(0.08f, 0.08f, 0.10f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glDrawElements(GL_TRIANGLES, (GLsizei)mesh.indices.size(), GL_UNSIGNED_INT, nullptr);
+        };
+
+        drawOnce(); // warm-up (shader variant compile 등)
+        glFinish();
+        sw.reset();
+        for (int f = 0; f < frames; ++f) drawOnce();
+        glFinish();
+        const double frameMs = sw.elapsed_ms() / frames;
+
+        // ---- 화질: float32 결과 대비 평균 픽셀 차이 ----
+        std::vector<uint8_t> pixels((size_t)W * H * 4);
+        glReadPixels(0, 0, W, H, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        double pixelDiff = 0.0;
+        if (referencePixels.empty()) {
+            referencePixels = pixels;
+        } else {
+            for (size_t i = 0; i < pixels.size(); ++i)
+                pixelDiff += std::abs((int)pixels[i] - (int)referencePixels[i]);
+            pixelDiff /= (double)pixels.size();
+        }
+
+        const double bytes = (double)vbo.size();
+        std::printf("%-20s %6zu %9.2f %7.1f%% %8.2fms %9.0f %7.2fms %8.2fms %10.2f\n",
+                    var.name, stride, bytes / (1024.0 * 1024.0), 100.0 * (1.0 - bytes / baseBytes),
+                    encodeMs, (mesh.vertexCount * 7 * sizeof(float)) / (encodeMs * 1e3),
+                    uploadMs, frameMs, bytes / (frameMs * 1e6));
+
+        // ---- CPU decode 검증 ----
+        allOk &= verifyAttrib("pos", at[0].type, 2, mesh.pos.data(), mesh.vertexCount, vbo.data(), stride, at[0].offset, pr);
+        allOk &= verifyAttrib("normal", at[1].type, 3, mesh.nrm.data(), mesh.vertexCount, vbo.data(), stride, at[1].offset, nullptr);
+        allOk &= verifyAttrib("uv", at[2].type, 2, mesh.uv.data(), mesh.vertexCount, vbo.data(), stride, at[2].offset, nullptr);
+        std::printf("    mean |pixel - float32| = %.4f / 255\n\n", pixelDiff);
+
+        glBindVertexArray(0);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &vb);
+    }
+
+    destroyRenderTarget(rt);
+    glDeleteBuffers(1, &ebo);
+    glDeleteProgram(program);
+    destroyHeadlessContext(hc);
+
+    if (!allOk) {
+        std::fprintf(stderr, "quantization error exceeded tolerance or encoder differs from the scalar reference!\n");
+        return 1;
+    }
+    return 0;
+}